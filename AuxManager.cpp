@@ -8,6 +8,8 @@
 #include "InterlockManager.h"
 #include "ButtonManager.h"       // pollButtons() for wait loops
 #include "EepromManager.h"
+#include "TimerService.h"
+#include "TripLog.h"
 
 #include "ST7365P_Display.h"
 extern ST7365P_Display tft;
@@ -44,6 +46,9 @@ static void rtSetBrightness(uint8_t c) { rtWrite(0x01, c); }
 /* ===================================================================== */
 AuxState auxState = { 128, false, 500, AUX_EDIT_NONE };
 
+/* internal-test screen up: modal, AUX rows stay off the panel          */
+static TimerId testTimer = TIMER_NONE;
+
 /* ===================================================================== */
 /*  Auto-reset background tick                                           */
 /* ===================================================================== */
@@ -54,55 +59,85 @@ void auxTick()
 {
     if (!auxState.autoResetEnable) return;
 
-    bool giLow = readInterlock(1, 2);               // P10 LOW = tripped
-    if (giLow && !arPending) { arPending = true; arStartMs = millis(); }
+    bool giLow = !(interlockInputs() & GLOBAL_PIN);  // kept current by INT
+    if (giLow && !arPending && !resetPulseActive()) {
+        arPending = true; arStartMs = millis();
+    }
 
     if (arPending && millis() - arStartMs >= auxState.autoResetDelay) {
-        sendResetPulse();
+        if (sendResetPulse()) {
+            consoleLog("Reset pulse (auto)");
+            tripLogAppend(TRIP_CAUSE_RESET, TRIP_ACTION_PULSE_AUTO,
+                          interlockInputs(), interlockInputs());
+        }
         arPending = false;
     }
 }
 
+/* ===================================================================== */
+/*  Format progress (display task)                                       */
+/* ===================================================================== */
+void auxRefresh()
+{
+    static bool    wasBusy  = false;
+    static uint8_t shownPct = 0;
+
+    const bool    busy = eepromFormatBusy();
+    const uint8_t pct  = eepromFormatPercent();
+    if (busy == wasBusy && (!busy || pct == shownPct)) return;
+
+    if (wasBusy && !busy && pct >= 100) consoleLog("EEPROM format done");
+    wasBusy  = busy;
+    shownPct = pct;
+    if (menuState.screen == SCREEN_MENU && menuState.currentTab == TAB_AUXILIARY)
+        redrawAuxRow(AUX_EEPROM_FORMAT);
+}
+
 /* ===================================================================== */
 /*  Line redraw helpers (called from DisplayManager)                     */
 /* ===================================================================== */
 void redrawAuxRow(uint8_t idx)   /* declaration lives in AuxManager.h   */
 {
-    const uint16_t y   = 30 + idx * 24;
-    const bool     sel = (idx == menuState.selectedItem);
+    if (testTimer != TIMER_NONE) return;  /* test screen owns the body   */
 
-    tft.fillRect(0, y, 480, 24, sel ? COLOR_SELECTED_BG : COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.setTextColor(sel ? COLOR_YELLOW : COLOR_WHITE);
-    tft.setCursor(2, y + 6);
+    const bool sel = (idx == menuState.selectedItem);
+    char line[40];
 
     switch (idx)
     {
         case AUX_LCD_BRIGHTNESS:
-            tft.print(F("LCD brightness: "));
-            tft.print(auxState.lcdBrightness);
+            snprintf(line, sizeof(line), "LCD brightness: %u",
+                     auxState.lcdBrightness);
             break;
 
         case AUX_INTERNAL_TEST:
-            tft.print(F("Internal test  (long OK)"));
+            snprintf(line, sizeof(line), "Internal test  (long OK)");
             break;
 
         case AUX_EEPROM_FORMAT:
-            tft.print(F("EEPROM format   (long OK)"));
+            if (eepromFormatBusy()) {
+                snprintf(line, sizeof(line), "Formatting %u%%  (OK cancels)",
+                         eepromFormatPercent());
+                paintRowProgress(idx, line, eepromFormatPercent(), sel);
+                return;
+            }
+            snprintf(line, sizeof(line), "EEPROM format   (long OK)");
             break;
 
         case AUX_AUTO_RESET:
-            tft.print(F("Autoreset: "));
-            tft.print(auxState.autoResetEnable ? F("ON ") : F("OFF"));
-            tft.print(F("  t="));
-            tft.print(auxState.autoResetDelay);
-            tft.print(F(" ms"));
+            snprintf(line, sizeof(line), "Autoreset: %s  t=%u ms",
+                     auxState.autoResetEnable ? "ON " : "OFF",
+                     auxState.autoResetDelay);
             break;
 
         case AUX_POWER_LUT:
-            tft.print(F("Power LUT  (locked)"));
+            snprintf(line, sizeof(line), "Power LUT  (locked)");
             break;
+
+        default:
+            return;
     }
+    paintRowText(idx, line, sel);   /* repaints only what changed */
 }
 
 static void redrawAuxList()
@@ -120,11 +155,19 @@ void auxInit()
     rtSetBrightness(auxState.lcdBrightness);
 }
 
+/* idle screen: dark while the panel sleeps, user setting on wake       */
+void auxBacklight(bool on)
+{
+    rtSetBrightness(on ? auxState.lcdBrightness : 0);
+}
+
 /* ===================================================================== */
 /*  Encoder handler                                                      */
 /* ===================================================================== */
 void auxEncoder(int8_t delta)
 {
+    if (auxDismissTest()) return;         /* a turn closes it like a key */
+
     switch (menuState.selectedItem)
     {
         /* live 0-255 back-light code */
@@ -153,15 +196,42 @@ void auxEncoder(int8_t delta)
 /* ===================================================================== */
 void auxHandleShort()
 {
+    if (menuState.selectedItem == AUX_EEPROM_FORMAT && eepromFormatBusy())
+    {
+        eepromFormatCancel();
+        consoleLog("EEPROM format cancelled");
+        redrawAuxRow(AUX_EEPROM_FORMAT);
+        return;
+    }
+
     if (menuState.selectedItem == AUX_AUTO_RESET &&
         auxState.editMode == AUX_EDIT_BYTE)
     {
         auxState.editMode = AUX_EDIT_NONE;
         updateEditIndicator(false);
         redrawAuxRow(AUX_AUTO_RESET);
+        saveAuxSettings();                  /* delay confirmed: written behind */
     }
 }
 
+/* ===================================================================== */
+/*  Internal-test result screen                                          */
+/* ===================================================================== */
+static void endInternalTest()
+{
+    testTimer = TIMER_NONE;
+    invalidateDisplayCache();             /* body was drawn over, panel is fine */
+    redrawAll();
+}
+
+bool auxDismissTest()
+{
+    if (testTimer == TIMER_NONE) return false;
+    timerCancel(testTimer);
+    endInternalTest();
+    return true;
+}
+
 /* ===================================================================== */
 /*  OK – long                                                            */
 /* ===================================================================== */
@@ -191,7 +261,7 @@ void auxHandleLong()
                 Wire.beginTransmission(d.addr);
                 bool ok = (Wire.endTransmission() == 0);
 
-                tft.setTextColor(ok ? COLOR_GREEN : COLOR_RED);
+                tft.setTextColor(ok ? COLOR_GREEN : COLOR_RED, COLOR_BLACK);
                 // compose "name @0xXX  OK/MISSING"
                 snprintf(line, sizeof(line),
                          "%-12s @0x%02X  %s",
@@ -204,30 +274,21 @@ void auxHandleLong()
             bool spiOk = digitalRead(7) == LOW;
             digitalWrite(7, HIGH); pinMode(7, INPUT_PULLUP);
 
-            tft.setTextColor(spiOk ? COLOR_GREEN : COLOR_RED);
+            tft.setTextColor(spiOk ? COLOR_GREEN : COLOR_RED, COLOR_BLACK);
             snprintf(line, sizeof(line),
                      "%-12s        %s", "SPI-Flash", spiOk ? "OK" : "MISSING");
             tft.println(line);
 
-            /* wait max 10 s or until any key press */
-            uint32_t t0 = millis();
-            while (millis() - t0 < 10000) { pollButtons(); delay(10); }
-            initDisplay();
-            redrawAuxList();
+            /* back to the list after 10 s or on any key press */
+            testTimer = timerAfter(10000, endInternalTest);
             break;
         }
 
-        /* ── 2) full EEPROM erase ────────────────────────────────── */
+        /* ── 2) full EEPROM erase, in the background ─────────────── */
         case AUX_EEPROM_FORMAT:
         {
-            tft.fillRect(100, 120, 280, 40, COLOR_BLACK);
-            tft.drawRect(100, 120, 280, 40, COLOR_WHITE);
-            tft.setCursor(110, 130);
-            tft.setTextColor(COLOR_WHITE);
-            tft.print(F("Formatting …"));
-            eepromChipErase();
-            delay(600);
-            redrawAuxList();
+            if (eepromFormatStart()) consoleLog("EEPROM format started");
+            redrawAuxRow(AUX_EEPROM_FORMAT);
             break;
         }
 
@@ -248,6 +309,7 @@ void auxHandleLong()
                 updateEditIndicator(false);
             }
             redrawAuxRow(AUX_AUTO_RESET);
+            saveAuxSettings();                  /* enable or delay changed */
             break;
         }
 
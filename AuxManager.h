@@ -18,8 +18,8 @@ enum AuxIdx : uint8_t {
 enum AuxEditMode : uint8_t { AUX_EDIT_NONE = 0, AUX_EDIT_BYTE };
 
 /* ────────────────────────────────────────────
-   Settings that must survive while the UI
-   is running.  (Persist to EEPROM later.)     */
+   Aux-tab settings.  The auto-reset pair is
+   kept in the EEPROM settings record.         */
 struct AuxState {
     uint8_t     lcdBrightness;     // 0-255 RT4527A DAC code
     bool        autoResetEnable;   // ON/OFF
@@ -33,9 +33,12 @@ extern AuxState auxState;
 /* public API used by main sketch / managers  */
 void auxInit();               // call from setup()
 void auxTick();               // call every loop()
+void auxRefresh();            // display task: format progress row
 void auxEncoder(int8_t d);    // rotary delta
 void auxHandleShort();        // short OK
 void auxHandleLong();         // long  OK
+void auxBacklight(bool on);   // idle screen: RT4527A off / back to setting
+bool auxDismissTest();        // close the internal-test screen, false if none
 
 /* helper used by DisplayManager.cpp          */
 void redrawAuxRow(uint8_t idx);
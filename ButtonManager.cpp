@@ -7,6 +7,8 @@
 #include "InterlockManager.h"
 #include "EepromManager.h"
 #include "AuxManager.h"
+#include "FaultRecorder.h"
+#include "TripLog.h"
 
 /* ────── forward-declare the handlers (needed!) ────── */
 static void onShort (uint8_t idx);
@@ -51,11 +53,7 @@ void initButtons()
 /* ------------------------------------------------------------------ */
 void pollButtons()
 {
-    static uint32_t next = 0;
-    uint32_t us = micros();
-    if ((int32_t)(us - next) < 0) return;
-    next = us + 5000;
-
+    /* called every 5 ms by the scheduler: DB_TICKS = 20 ms debounce */
     uint32_t port = PORT->Group[0].IN.reg;
     bool raw[BTN_COUNT] = {
         !(port & (1ul << BTN_DOWN_BIT)),
@@ -117,15 +115,21 @@ static void onShort(uint8_t idx)
 {
     bumpIdleTimer();
 
+    /* any key closes the internal-test result screen */
+    if (auxDismissTest()) return;
+
     /* wake from idle */
     if (menuState.screen == SCREEN_IDLE) {
-        menuState.screen = SCREEN_MENU;
-        redrawAll();
+        wakeFromIdle();
         return;
     }
 
     /* navigation */
-    if (idx == IDX_UP) {
+    if ((idx == IDX_UP || idx == IDX_DOWN) &&
+        itemCountForTab(menuState.currentTab) == 0) {
+        /* nothing selectable (Log tab) */
+    }
+    else if (idx == IDX_UP) {
         if (menuState.selectedItem == NO_SELECTION) selectLastIfNone();
         else if (menuState.selectedItem) menuState.selectedItem--;
         updateItem();
@@ -147,13 +151,22 @@ static void onShort(uint8_t idx)
         updateTab();
     }
 
-    /* confirm edit (Overview) */
+    /* confirm edit (Overview): only a simulatable item has a state to apply */
     else if (idx == IDX_OK &&
-             menuState.editMode && menuState.currentTab == TAB_OVERVIEW)
+             menuState.editMode && menuState.currentTab == TAB_OVERVIEW &&
+             menuState.selectedItem < INTERLOCK_COUNT &&
+             interlocks[menuState.selectedItem].allowSim)
     {
         applyEditStateToItem(menuState.selectedItem,
                              menuState.editStateIndex);
-        saveOverviewSettings();
+        saveOverviewItem(menuState.selectedItem);   // written behind
+
+        static const char* const modes[3] = { "input", "sim ON", "sim OFF" };
+        char line[40];
+        snprintf(line, sizeof(line), "%s -> %s",
+                 interlocks[menuState.selectedItem].label,
+                 modes[menuState.editStateIndex % 3]);
+        consoleLog(line);
         menuState.editMode = false;
         updateEditIndicator(false);
         paintItem(menuState.selectedItem, true);
@@ -168,6 +181,7 @@ static void onShort(uint8_t idx)
 static void onLong(uint8_t idx)
 {
     bumpIdleTimer();
+    if (auxDismissTest()) return;
 
     /* Aux tab takes priority */
     if (menuState.currentTab == TAB_AUXILIARY && idx == IDX_OK) {
@@ -183,13 +197,26 @@ static void onLong(uint8_t idx)
             paintItem(menuState.selectedItem, true);
     }
 
+    /* acknowledge the latched first-fault sequence */
+    if (idx == IDX_UP && menuState.currentTab == TAB_OVERVIEW &&
+        faultLatched())
+    {
+        acknowledgeFaults();
+        consoleLog("Faults acknowledged");
+        redrawAll();                      /* only badge rows change */
+    }
+
     /* send reset pulse (Overview item 8) */
     if (idx == IDX_DOWN &&
         menuState.currentTab == TAB_OVERVIEW &&
         menuState.selectedItem == 8)
     {
-        flashResetIndicator();
-        sendResetPulse();
+        if (sendResetPulse()) {
+            flashResetIndicator();
+            consoleLog("Reset pulse (manual)");
+            tripLogAppend(TRIP_CAUSE_RESET, TRIP_ACTION_PULSE_MANUAL,
+                          interlockInputs(), interlockInputs());
+        }
     }
 }
 
@@ -4,37 +4,281 @@
 #include "MenuState.h"
 #include "InterlockManager.h"
 #include "AuxManager.h"
+#include "RowCompositor.h"
+#include "LedSprites.h"
+#include "FaultRecorder.h"
+#include "TimerService.h"
+#include "Scheduler.h"
+#include "TripStats.h"
 
 /* ───── single global display instance ───── */
-ST7365P_Display tft;
+static ST7365P_SercomTransport tftBus;     // or ST7365P_BitBangTransport
+ST7365P_Display tft(tftBus);
+
+/* ───── per call-site traffic counters ───── */
+#if ST7365P_STATS
+static_assert(STAT_SITE_COUNT <= ST7365P_Display::STAT_SITES,
+              "raise ST7365P_Display::STAT_SITES");
+
+/* the outermost public entry point owns everything drawn beneath it */
+class StatScope {
+public:
+    explicit StatScope(DisplayStatSite site) : owner(tft.statSite == STAT_OTHER)
+    {
+        if (!owner) return;
+        tft.statSite = site;
+        tft.stats[site].calls++;
+        t0 = micros();
+    }
+    ~StatScope()
+    {
+        if (!owner) return;
+        tft.stats[tft.statSite].micros += micros() - t0;
+        tft.statSite = STAT_OTHER;
+    }
+private:
+    bool     owner;
+    uint32_t t0 = 0;
+};
+#define STAT_SCOPE(site)  StatScope statScope_(site)
+#else
+#define STAT_SCOPE(site)  ((void)0)
+#endif
+
+void dumpDisplayStats()
+{
+#if ST7365P_STATS
+    static const char* const names[STAT_SITE_COUNT] = {
+        "other", "redrawAll", "updateItem", "updateTab",
+        "idle/wake", "flashResetIndicator"
+    };
+    char line[96];
+    Serial.println(F("[TFT] site                 calls    cmds     data  windows   pixels       us"));
+    for (uint8_t i = 0; i < STAT_SITE_COUNT; ++i) {
+        const auto &st = tft.stats[i];
+        snprintf(line, sizeof(line), "[TFT] %-20s %6lu %7lu %8lu %8lu %8lu %8lu",
+                 names[i], (unsigned long)st.calls, (unsigned long)st.commands,
+                 (unsigned long)st.dataBytes, (unsigned long)st.windows,
+                 (unsigned long)st.pixels, (unsigned long)st.micros);
+        Serial.println(line);
+    }
+#endif
+}
+
+void resetDisplayStats()
+{
+#if ST7365P_STATS
+    for (auto &st : tft.stats) st = ST7365P_Display::Stats();
+#endif
+}
 
 /* helpers declared up-front */
 static void paintTab(TabID tab, bool selected);
-static void paintOverviewItem(uint8_t idx, bool selected);
-static void paintDummyItem   (uint8_t idx, bool selected);
+static void paintOverviewItem(uint8_t idx, bool selected, const TcaPorts& io);
+static void paintStatsItem   (uint8_t idx, bool selected);
+static void onInterlockChange(const InterlockEvent& ev);
 void        redrawAuxRow     (uint8_t idx);          // from AuxManager.cpp
 
 static uint8_t lastTab  = 0;
-static int8_t  lastItem = NO_SELECTION;
+static uint8_t lastItem = NO_SELECTION;
+
+/* ─────────────────────────────────────────── */
+/* 0.  RETAINED-MODE CACHE                     */
+/*     what each tab / row / LED last showed;  */
+/*     paint calls only touch what differs     */
+/* ─────────────────────────────────────────── */
+static constexpr uint8_t  MAX_ROWS   = 9;
+static constexpr uint8_t  ROW_CHARS  = 48;
+static constexpr uint16_t ROW_H      = 24;
+static constexpr uint16_t BODY_Y     = 30;
+static constexpr uint16_t TEXT_X     = 2;
+static constexpr uint16_t TEXT_DY    = 2;                /* 19 px font cell  */
+static constexpr uint16_t LED_X      = 460;
+static constexpr uint16_t BAR_X      = 300;               /* progress bar    */
+static constexpr uint16_t BAR_W      = 150;
+static constexpr uint16_t BAR_H      = 12;
+static constexpr uint8_t  BAR_NONE   = 0xFF;
+
+enum LedMode : uint8_t { LED_NONE = 0, LED_PLAIN, LED_RING };
+
+struct RowContent {
+    char     text[ROW_CHARS];
+    uint16_t fg, bg;
+    uint16_t ledColor;
+    LedMode  led;
+    uint8_t  bar;                                       /* % or BAR_NONE  */
+};
+
+static RowContent shown[MAX_ROWS];
+static bool       rowValid[MAX_ROWS];
+static int8_t     tabShown[TAB_COUNT] = { -1, -1, -1, -1 }; /* -1 = unknown  */
+static int8_t     editShown  = -1;
+static bool       bodyValid  = false;
+
+void invalidateDisplayCache()
+{
+    for (uint8_t i = 0; i < MAX_ROWS;  ++i) rowValid[i] = false;
+    for (uint8_t i = 0; i < TAB_COUNT; ++i) tabShown[i] = -1;
+    editShown = -1;
+    bodyValid = false;
+}
+
+static inline uint16_t rowY(uint8_t idx) { return BODY_Y + idx * ROW_H; }
+
+/* blank the body once; afterwards rows are known to be empty black     */
+static void clearBodyIfNeeded()
+{
+    if (bodyValid) return;
+    tft.fillRect(0, BODY_Y, 480, 242, COLOR_BLACK);
+    for (uint8_t i = 0; i < MAX_ROWS; ++i) {
+        shown[i].text[0] = '\0';
+        shown[i].fg  = shown[i].bg = COLOR_BLACK;
+        shown[i].led = LED_NONE;
+        shown[i].bar = BAR_NONE;
+        rowValid[i]  = true;
+    }
+    bodyValid = true;
+}
+
+/* off-screen row: palette 0 = background, 1 = text, 2 = LED ring,
+   3 = LED colour, 4 = progress fill                                    */
+static RowCompositor rowBuf;
+enum : uint8_t { PAL_BG = 0, PAL_TEXT, PAL_RING, PAL_LED, PAL_BAR };
+
+static inline uint16_t barFill(uint8_t pct) { return (uint32_t)(BAR_W - 2) * pct / 100; }
+
+static void composeRow(const RowContent& c)
+{
+    rowBuf.setPalette(PAL_BG,   c.bg);
+    rowBuf.setPalette(PAL_TEXT, c.fg);
+    rowBuf.setPalette(PAL_RING, c.led == LED_RING ? COLOR_YELLOW : c.bg);
+    rowBuf.setPalette(PAL_LED,  c.ledColor);
+    rowBuf.clear(PAL_BG);
+    rowBuf.drawText(TEXT_X, TEXT_DY, c.text, fontUi16, PAL_TEXT);
+    if (c.led != LED_NONE)
+        rowBuf.drawSprite(LED_X - 10, ROW_H / 2 - 10, LED_SPRITE, PAL_RING);
+    if (c.bar != BAR_NONE) {
+        const int16_t y = (ROW_H - BAR_H) / 2;
+        rowBuf.setPalette(PAL_BAR, COLOR_GREEN);
+        rowBuf.fillRect(BAR_X, y, BAR_W, BAR_H, PAL_TEXT);
+        rowBuf.fillRect(BAR_X + 1, y + 1, BAR_W - 2, BAR_H - 2, PAL_BG);
+        rowBuf.fillRect(BAR_X + 1, y + 1, barFill(c.bar), BAR_H - 2, PAL_BAR);
+    }
+}
+
+/* status dot straight from the constexpr sprite: one 21×21 window */
+static void paintLed(uint16_t y, const RowContent& c)
+{
+    const uint16_t ring = c.led == LED_RING ? COLOR_YELLOW : c.bg;
+    const uint16_t dot  = c.led == LED_NONE ? c.bg : c.ledColor;
+    const uint16_t colors[3] = { c.bg, ring, dot };
+    tft.drawSprite(LED_X - 10, y + ROW_H / 2 - 10, LED_SPRITE, colors);
+}
+
+/* paint one body row: compose it off-screen, then send only the columns
+   that differ from the cache in one window                              */
+static void paintRow(uint8_t idx, const char* text, bool sel,
+                     LedMode led = LED_NONE, uint16_t ledColor = COLOR_BLACK,
+                     uint8_t bar = BAR_NONE)
+{
+    if (idx >= MAX_ROWS) return;
+
+    RowContent want;
+    strncpy(want.text, text, ROW_CHARS - 1);
+    want.text[ROW_CHARS - 1] = '\0';
+    want.fg       = sel ? COLOR_YELLOW : COLOR_WHITE;
+    want.bg       = sel ? COLOR_SELECTED_BG : COLOR_BLACK;
+    want.led      = led;
+    want.ledColor = ledColor;
+    want.bar      = bar;
+
+    RowContent& was = shown[idx];
+    uint16_t tx0 = 0, tx1 = 0;                            /* dirty text     */
+    uint16_t lx0 = 0, lx1 = 0;                            /* dirty LED box  */
+    uint16_t bx0 = 0, bx1 = 0;                            /* dirty bar      */
+
+    if (!rowValid[idx] || was.bg != want.bg) {
+        tx0 = 0; tx1 = 480;
+    } else {
+        /* text: from the first differing character to the longer end */
+        uint8_t p = 0;
+        if (was.fg == want.fg)
+            while (want.text[p] && want.text[p] == was.text[p]) ++p;
+        while (p && (want.text[p] & 0xC0) == 0x80) --p;   /* UTF-8 boundary */
+        if (want.text[p] || was.text[p]) {
+            const uint16_t oldW = rleTextWidth(fontUi16, was.text);
+            const uint16_t newW = rleTextWidth(fontUi16, want.text);
+            tx0 = TEXT_X + rleTextWidth(fontUi16, want.text, p);
+            tx1 = TEXT_X + (oldW > newW ? oldW : newW);
+        }
+        if (was.led != want.led ||
+            (want.led != LED_NONE && was.ledColor != want.ledColor)) {
+            lx0 = LED_X - 10;
+            lx1 = LED_X + 11;
+        }
+        if (was.bar != want.bar) {                        /* whole bar, or  */
+            bx0 = BAR_X;                                  /* the fill delta */
+            bx1 = BAR_X + BAR_W;
+            if (was.bar != BAR_NONE && want.bar != BAR_NONE) {
+                const uint16_t a = barFill(was.bar), b = barFill(want.bar);
+                bx0 = BAR_X + 1 + (a < b ? a : b);
+                bx1 = BAR_X + 1 + (a < b ? b : a);
+            }
+            if (tx0 < tx1 && bx0 < tx1) {                 /* overlaps text  */
+                if (bx1 > tx1) tx1 = bx1;
+                bx0 = bx1 = 0;
+            }
+        }
+    }
+
+    if (tx0 >= tx1 && bx0 >= bx1 && lx0 < lx1) {         /* LED only       */
+        paintLed(rowY(idx), want);
+    } else if (tx0 < tx1 || lx0 < lx1 || bx0 < bx1) {
+        composeRow(want);
+        const uint16_t y = rowY(idx);
+        if (tx0 < tx1 && lx0 < lx1 && lx0 <= tx1 + 32) {  /* close: merge  */
+            tx1 = lx1; lx1 = lx0;
+        }
+        if (tx0 < tx1) rowBuf.flush(tft, y, tx0, tx1 - tx0);
+        if (lx0 < lx1) rowBuf.flush(tft, y, lx0, lx1 - lx0);
+        if (bx0 < bx1) rowBuf.flush(tft, y, bx0, bx1 - bx0);
+    }
+    was = want;
+    rowValid[idx] = true;
+}
+
+/* used by AuxManager.cpp for its text-only rows */
+void paintRowText(uint8_t idx, const char* text, bool sel)
+{
+    paintRow(idx, text, sel);
+}
+
+/* same, with a progress bar; only the grown part of the fill is sent */
+void paintRowProgress(uint8_t idx, const char* text, uint8_t percent, bool sel)
+{
+    paintRow(idx, text, sel, LED_NONE, COLOR_BLACK, percent > 100 ? 100 : percent);
+}
 
 /* ─────────────────────────────────────────── */
 /* 1.  HEADER (TAB BAR)                        */
 /* ─────────────────────────────────────────── */
 static void paintTab(TabID tab, bool sel)
 {
-    const uint16_t x = 10 + tab * 160;
-    tft.fillRect(x, 0, 150, 24, sel ? COLOR_SELECTED_BG : COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.setTextColor(sel ? COLOR_YELLOW : COLOR_WHITE);
-    tft.setCursor(x, 4);
-    switch (tab) {
-        case TAB_OVERVIEW:  tft.print("Overview");  break;
-        case TAB_SETTINGS:  tft.print("Settings");  break;
-        case TAB_AUXILIARY: tft.print("Aux");       break;
+    if (tabShown[tab] == (int8_t)sel) return;             /* unchanged      */
+
+    const uint16_t x = 10 + tab * 120;
+    if (tabShown[tab] < 0) {                              /* first paint    */
+        tft.fillRect(x, 0, 110, 24, COLOR_BLACK);
+        if (tab == TAB_COUNT - 1) editShown = -1;         /* overlaps 'E'   */
     }
+    static const char* const names[TAB_COUNT] = { "Overview", "Settings", "Aux", "Log" };
+    tft.drawString(x, 3, names[tab], fontUi16,
+                   sel ? COLOR_YELLOW : COLOR_WHITE,
+                   sel ? COLOR_SELECTED_BG : COLOR_BLACK);
+    tabShown[tab] = sel;
 }
 
-/* helper ─ redraw the whole header in one go                        */
+/* helper ─ bring the header up to date (unchanged tabs cost nothing) */
 static void refreshHeader()
 {
     for (uint8_t i = 0; i < TAB_COUNT; ++i)
@@ -44,25 +288,17 @@ static void refreshHeader()
 /* ─────────────────────────────────────────── */
 /* 2.  OVERVIEW ROW                            */
 /* ─────────────────────────────────────────── */
-static void drawStatusCircle(int16_t x,int16_t y,uint16_t col,bool outline)
-{
-    if (outline){
-        tft.fillCircle(x,y,10,COLOR_YELLOW);
-        tft.fillCircle(x,y, 8,col);
-    } else tft.fillCircle(x,y,8,col);
-}
+/* expander state each Overview row was last painted from, per pin */
+static TcaPorts ledIo = { 0xFFFF, 0xFFFF, 0xFFFF };
 
-static void paintOverviewItem(uint8_t i,bool sel)
+/* io: one expander snapshot shared by every row of the same refresh */
+static void paintOverviewItem(uint8_t i,bool sel,const TcaPorts& io)
 {
-    const uint16_t y = 30 + i*24;
     const auto &it   = interlocks[i];
-
-    /* row background */
-    tft.fillRect(0,y,480,24, sel?COLOR_SELECTED_BG:COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.setTextColor(sel?COLOR_YELLOW:COLOR_WHITE);
-    tft.setCursor(2,y+6);
-    tft.print(it.label);
+    const uint16_t m = it.mask();
+    ledIo.input  = (ledIo.input  & ~m) | (io.input  & m);
+    ledIo.output = (ledIo.output & ~m) | (io.output & m);
+    ledIo.config = (ledIo.config & ~m) | (io.config & m);
 
     /* status colour -------------------------------------------------- */
     bool outline = false;
@@ -76,50 +312,165 @@ static void paintOverviewItem(uint8_t i,bool sel)
             case 2: col = COLOR_GREEN; outline = true;  break;
         }
     } else {
-        bool sim = isSimulated(it.port,it.bit);
+        bool sim = io.driven(it.port,it.bit);
         if (sim) {                               /* simulation colours  */
-            bool o = (readOutputRegister(it.port)>>it.bit) & 1;
+            bool o = io.latch(it.port,it.bit);
             col = o ? COLOR_GREEN : COLOR_RED;
             outline = true;
         } else {                                 /* real input          */
-            bool v = readInterlock(it.port,it.bit);   // LOW = FAULT
+            bool v = !io.level(it.port,it.bit);       // LOW = FAULT
             col = v ? COLOR_GREEN : COLOR_RED;        // green ↔ red swap
             outline = false;
         }
     }
-    drawStatusCircle(460,y+12,col,outline);
+
+    /* first-fault badge: order and delay after the first trip ------- */
+    char text[ROW_CHARS];
+    const uint8_t rank = faultRank(i);
+    const uint32_t dt  = faultDelayUs(i);
+    if (!rank)
+        snprintf(text, sizeof(text), "%s", it.label);
+    else if (rank == 1)
+        snprintf(text, sizeof(text), "%s   #1", it.label);
+    else if (dt < 10000)
+        snprintf(text, sizeof(text), "%s   #%u  +%lu us", it.label,
+                 (unsigned)rank, (unsigned long)dt);
+    else
+        snprintf(text, sizeof(text), "%s   #%u  +%lu ms", it.label,
+                 (unsigned)rank, (unsigned long)(dt / 1000));
+    paintRow(i, text, sel, outline ? LED_RING : LED_PLAIN, col);
 }
 
 /* ─────────────────────────────────────────── */
-/* 3.  SETTINGS – placeholder rows            */
+/* 3.  SETTINGS – trip statistics per channel */
 /* ─────────────────────────────────────────── */
-static void paintDummyItem(uint8_t idx,bool sel)
+static void paintStatsItem(uint8_t idx,bool sel)
 {
-    const uint16_t y = 30 + idx*24;
-    tft.fillRect(0,y,480,24, sel?COLOR_SELECTED_BG:COLOR_BLACK);
-    tft.setTextSize(2);
-    tft.setTextColor(sel?COLOR_YELLOW:COLOR_WHITE);
-    tft.setCursor(2,y+6);
-    tft.print("Item ");
-    tft.print(idx+1);
+    if (idx >= INTERLOCK_COUNT) return;      /* label lookup below */
+    char line[ROW_CHARS];
+    const TripStats& st = tripStats(idx);
+    const uint32_t now  = millis();
+    const uint32_t rate = st.perHourX10(now);
+    const uint32_t s    = st.lastTripMs / 1000;
+
+    if (!st.count)
+        snprintf(line, sizeof(line), "%s  no trips", interlocks[idx].label);
+    else if (!st.closed)
+        snprintf(line, sizeof(line), "%s  %ux  %lu:%02lu:%02lu  -  %lu.%lu/h",
+                 interlocks[idx].label, (unsigned)st.count,
+                 (unsigned long)(s / 3600), (unsigned long)(s / 60 % 60),
+                 (unsigned long)(s % 60),
+                 (unsigned long)(rate / 10), (unsigned long)(rate % 10));
+    else
+        snprintf(line, sizeof(line), "%s  %ux  %lu:%02lu:%02lu  %lu/%lu/%lu ms  %lu.%lu/h",
+                 interlocks[idx].label, (unsigned)st.count,
+                 (unsigned long)(s / 3600), (unsigned long)(s / 60 % 60),
+                 (unsigned long)(s % 60),
+                 (unsigned long)st.minMs, (unsigned long)st.meanMs(),
+                 (unsigned long)st.maxMs,
+                 (unsigned long)(rate / 10), (unsigned long)(rate % 10));
+    paintRow(idx, line, sel);
+}
+
+/* Settings rows follow the statistics: channels with new events, plus
+   everything once a minute for the trips/hour drift; the row cache
+   drops repaints whose text came out the same                        */
+void refreshTripStatsRows()
+{
+    static uint32_t lastMin = 0;
+    uint16_t dirty = takeTripStatsDirty();
+    const uint32_t min = millis() / 60000;
+    if (min != lastMin) { lastMin = min; dirty = 0xFFFF; }
+    if (menuState.currentTab != TAB_SETTINGS || !dirty) return;
+
+    const uint8_t n = itemCountForTab(TAB_SETTINGS);
+    for (uint8_t i = 0; i < n; ++i)
+        if (dirty & (1u << i)) paintStatsItem(i, i == menuState.selectedItem);
 }
 
 /* ─────────────────────────────────────────── */
-/* 4.  PUBLIC API                              */
+/* 4.  LOG TAB – hardware-scrolled console     */
+/*     GRAM slot k always holds ring line k;   */
+/*     scrolling puts the oldest one on top    */
 /* ─────────────────────────────────────────── */
-void redrawAll()
+static constexpr uint8_t CON_LINES = 10;                  /* 10 × 24 = 240 px */
+
+static char    conText[CON_LINES][ROW_CHARS];
+static uint8_t conHead    = 0;                            /* oldest = next   */
+static bool    conVisible = false;
+
+static void consolePaintSlot(uint8_t k)
+{
+    rowBuf.setPalette(PAL_BG,   COLOR_BLACK);
+    rowBuf.setPalette(PAL_TEXT, COLOR_WHITE);
+    rowBuf.clear(PAL_BG);
+    rowBuf.drawText(TEXT_X, TEXT_DY, conText[k], fontUi16, PAL_TEXT);
+    rowBuf.flush(tft, rowY(k));
+}
+
+static void consoleShow()
 {
-    refreshHeader();                                      /* full header */
+    tft.fillRect(0, BODY_Y, 480, 242, COLOR_BLACK);
+    for (uint8_t i = 0; i < MAX_ROWS; ++i) rowValid[i] = false; /* rows gone */
+    bodyValid = false;
+    tft.setScrollRegion(BODY_Y, CON_LINES * ROW_H);
+    for (uint8_t k = 0; k < CON_LINES; ++k)
+        if (conText[k][0]) consolePaintSlot(k);
+    tft.scrollTo(conHead * ROW_H);
+    conVisible = true;
+}
+
+static void consoleHide()
+{
+    tft.resetScroll();
+    conVisible = false;
+    bodyValid  = false;                                   /* GRAM holds log  */
+}
+
+void consoleLog(const char* text)
+{
+    const uint32_t s = millis() / 1000;
+    snprintf(conText[conHead], ROW_CHARS, "%02lu:%02lu:%02lu  %s",
+             (unsigned long)(s / 3600), (unsigned long)(s / 60 % 60),
+             (unsigned long)(s % 60), text);
+
+    /* one 24-px row plus one scroll-address update */
+    if (conVisible) {                           /* GRAM kept while idle */
+        consolePaintSlot(conHead);
+        conHead = (conHead + 1) % CON_LINES;
+        tft.scrollTo(conHead * ROW_H);
+    } else {
+        conHead = (conHead + 1) % CON_LINES;
+    }
+}
 
-    tft.fillRect(0,30,480,242,COLOR_BLACK);               /* clear body  */
+/* ─────────────────────────────────────────── */
+/* 5.  PUBLIC API                              */
+/* ─────────────────────────────────────────── */
+static void paintBody()
+{
+    if (menuState.currentTab == TAB_LOG) { consoleShow(); return; }
+    if (conVisible) consoleHide();
+    clearBodyIfNeeded();
     uint8_t n = itemCountForTab(menuState.currentTab);
+    TcaPorts io = {};
+    if (menuState.currentTab == TAB_OVERVIEW) io = readInterlockPorts();
     for(uint8_t i=0;i<n;++i){
         switch(menuState.currentTab){
-            case TAB_OVERVIEW:  paintOverviewItem(i,false); break;
-            case TAB_SETTINGS:  paintDummyItem   (i,false); break;
+            case TAB_OVERVIEW:  paintOverviewItem(i,i==menuState.selectedItem,io); break;
+            case TAB_SETTINGS:  paintStatsItem   (i,i==menuState.selectedItem); break;
             case TAB_AUXILIARY: redrawAuxRow     (i);       break;
         }
+        schedulerYield();                         /* protection between rows */
     }
+    for(uint8_t i=n;i<MAX_ROWS;++i) paintRow(i,"",false); /* leftovers      */
+}
+
+void redrawAll()
+{
+    STAT_SCOPE(STAT_REDRAW_ALL);
+    refreshHeader();
+    paintBody();
     updateEditIndicator(menuState.editMode);
 
     lastTab  = menuState.currentTab;
@@ -128,19 +479,11 @@ void redrawAll()
 
 void updateTab()
 {
+    STAT_SCOPE(STAT_UPDATE_TAB);
     if (menuState.currentTab == lastTab) return;
 
-    refreshHeader();                                      /* full header */
-
-    tft.fillRect(0,30,480,242,COLOR_BLACK);
-    uint8_t n = itemCountForTab(menuState.currentTab);
-    for(uint8_t i=0;i<n;++i){
-        switch(menuState.currentTab){
-            case TAB_OVERVIEW:  paintOverviewItem(i,false); break;
-            case TAB_SETTINGS:  paintDummyItem   (i,false); break;
-            case TAB_AUXILIARY: redrawAuxRow     (i);       break;
-        }
-    }
+    refreshHeader();
+    paintBody();
     updateEditIndicator(menuState.editMode);
 
     lastTab  = menuState.currentTab;
@@ -149,73 +492,160 @@ void updateTab()
 
 void updateItem()
 {
+    STAT_SCOPE(STAT_UPDATE_ITEM);
+    TcaPorts io = {};
+    if (menuState.currentTab == TAB_OVERVIEW) io = readInterlockPorts();
     /* deselect old row */
     if (lastItem != NO_SELECTION){
         switch(menuState.currentTab){
-            case TAB_OVERVIEW:  paintOverviewItem(lastItem,false); break;
-            case TAB_SETTINGS:  paintDummyItem   (lastItem,false); break;
+            case TAB_OVERVIEW:  paintOverviewItem(lastItem,false,io); break;
+            case TAB_SETTINGS:  paintStatsItem   (lastItem,false); break;
             case TAB_AUXILIARY: redrawAuxRow     (lastItem);       break;
         }
     }
     /* draw newly selected row */
     if (menuState.selectedItem != NO_SELECTION){
         switch(menuState.currentTab){
-            case TAB_OVERVIEW:  paintOverviewItem(menuState.selectedItem,true); break;
-            case TAB_SETTINGS:  paintDummyItem   (menuState.selectedItem,true); break;
+            case TAB_OVERVIEW:  paintOverviewItem(menuState.selectedItem,true,io); break;
+            case TAB_SETTINGS:  paintStatsItem   (menuState.selectedItem,true); break;
             case TAB_AUXILIARY: redrawAuxRow     (menuState.selectedItem);      break;
         }
     }
     lastItem = menuState.selectedItem;
-    refreshHeader();                                      /* keep header pristine */
+    refreshHeader();                                      /* no-op unless stale */
 }
 
 void updateEditIndicator(bool on)
 {
+    if (editShown == (int8_t)on) return;
+    editShown = on;
     tft.fillRect(460,0,20,20,on?COLOR_RED:COLOR_BLACK);
-    if (on){
-        tft.setCursor(462,4);
-        tft.setTextColor(COLOR_BLACK);
-        tft.print('E');
-    }
+    if (on) tft.drawString(464,0,"E",fontUi16,COLOR_BLACK,COLOR_RED);
+}
+
+/* the '*' is not in the row cache: erase it by hand 300 ms later
+   (row 8 background is black on every tab; the Log tab redrew anyway) */
+static TimerId  flashTimer = TIMER_NONE;
+static uint16_t flashW     = 0;
+
+static void clearResetIndicator()
+{
+    flashTimer = TIMER_NONE;
+    if (menuState.currentTab == TAB_LOG) return;
+    tft.fillRect(420,rowY(8) + TEXT_DY,flashW,fontUi16.height,COLOR_SELECTED_BG);
 }
 
 void flashResetIndicator()
 {
-    const uint16_t y = 30 + 8*24;
-    paintOverviewItem(8,true);
-    tft.setTextSize(2);
-    tft.setTextColor(COLOR_YELLOW,COLOR_SELECTED_BG);
-    tft.setCursor(420,y+6);
-    tft.print('*');
-    delay(300);
-    paintOverviewItem(8,true);
+    STAT_SCOPE(STAT_FLASH_RESET);
+    const uint16_t y = rowY(8) + TEXT_DY;
+    paintOverviewItem(8,true,readInterlockPorts());
+    flashW = tft.drawString(420,y,"*",fontUi16,COLOR_YELLOW,COLOR_SELECTED_BG);
+    timerCancel(flashTimer);
+    flashTimer = timerAfter(300, clearResetIndicator);
+}
+
+/* idle: back-light off and panel asleep; the menu stays in GRAM and
+   keeps being updated, so waking is a few command bytes, no redraw.
+   The panel's power-up gaps run on a timer, never in the loop.        */
+static TimerId panelTimer = TIMER_NONE;
+
+static void panelStep(uint32_t ms, TimerCallback fn)
+{
+    timerCancel(panelTimer);
+    if (ms) panelTimer = timerAfter(ms, fn);
+    if (!panelTimer) fn();                      /* due now, or no free timer */
+}
+
+static void panelOn()
+{
+    panelTimer = TIMER_NONE;
+    tft.displayOn();
+    auxBacklight(true);
+}
+
+static void panelWake()
+{
+    panelTimer = TIMER_NONE;
+    tft.sleepOut();
+    panelStep(5, panelOn);                      /* DISPON 5 ms after SLPOUT */
+}
+
+static void panelSleep()
+{
+    panelTimer = TIMER_NONE;
+    tft.sleep();
 }
 
 void showIdleScreen()
 {
+    STAT_SCOPE(STAT_IDLE_SCREEN);
     menuState.screen = SCREEN_IDLE;
-    tft.fillScreen(COLOR_BLACK);
-    tft.setTextColor(COLOR_WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(60,120);
-    tft.print("European Spallation Source");
+    auxBacklight(false);
+    panelStep(tft.powerDelayMs(), panelSleep);
+}
+
+void wakeFromIdle()
+{
+    STAT_SCOPE(STAT_IDLE_SCREEN);
+    menuState.screen = SCREEN_MENU;
+    panelStep(tft.powerDelayMs(), panelWake);
 }
 
 void initDisplay()
 {
+    addInterlockListener(onInterlockChange);    /* no-op when re-run      */
     tft.begin();
     tft.setRotation(2);
     tft.setTextSize(2);
     tft.fillScreen(COLOR_BLACK);
+    invalidateDisplayCache();
     redrawAll();
 }
 
+/* input-change listener: log every channel that moved; the LEDs follow
+   on the next refreshOverviewLeds() tick                              */
+static void onInterlockChange(const InterlockEvent& ev)
+{
+    const uint16_t diff = ev.before ^ ev.after;
+    for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i) {
+        const auto& it = interlocks[i];
+        const uint16_t m = it.mask();
+        if (!(diff & m)) continue;
+
+        char line[ROW_CHARS];
+        const bool tripped = !(ev.after & m);
+        if (tripped && faultRank(i))
+            snprintf(line, sizeof(line), "%s tripped #%u", it.label,
+                     (unsigned)faultRank(i));
+        else
+            snprintf(line, sizeof(line), "%s %s", it.label,
+                     tripped ? "tripped" : "cleared");
+        consoleLog(line);
+    }
+}
+
+/* live LEDs: one snapshot, XOR against what the rows were painted from,
+   repaint only channels whose level, sim mode or sim level moved      */
+void refreshOverviewLeds()
+{
+    if (menuState.currentTab != TAB_OVERVIEW) return;     /* no bus at all */
+    const TcaPorts io = readInterlockPorts();
+    const uint16_t diff = (io.input  ^ ledIo.input)  |
+                          (io.output ^ ledIo.output) |
+                          (io.config ^ ledIo.config);
+    if (!diff) return;
+    for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i)
+        if (diff & interlocks[i].mask())
+            paintOverviewItem(i, i == menuState.selectedItem, io);
+}
+
 /* helper for modules that only know the index */
 void paintItem(uint8_t idx, bool sel)
 {
     switch (menuState.currentTab){
-        case TAB_OVERVIEW:  paintOverviewItem(idx,sel); break;
-        case TAB_SETTINGS:  paintDummyItem   (idx,sel); break;
+        case TAB_OVERVIEW:  paintOverviewItem(idx,sel,readInterlockPorts()); break;
+        case TAB_SETTINGS:  paintStatsItem   (idx,sel); break;
         case TAB_AUXILIARY: redrawAuxRow     (idx);     break;
     }
 }
@@ -9,8 +9,28 @@ void updateTab();
 void updateItem();
 void updateEditIndicator(bool active);
 void showIdleScreen();
+void wakeFromIdle();
 void flashResetIndicator();
 void paintItem(uint8_t index, bool selected);
+void paintRowText(uint8_t index, const char* text, bool selected);
+void paintRowProgress(uint8_t index, const char* text, uint8_t percent, bool selected);
+void invalidateDisplayCache();   // after drawing outside the row/tab helpers
+void consoleLog(const char* text);  // append a time-stamped line to the Log tab
+void refreshOverviewLeds();      // periodic: repaint LEDs whose channel changed
+void refreshTripStatsRows();     // periodic: Settings rows whose statistics changed
+
+/* bus-traffic attribution (tft.stats[site] when ST7365P_STATS = 1) */
+enum DisplayStatSite : uint8_t {
+  STAT_OTHER = 0,
+  STAT_REDRAW_ALL,
+  STAT_UPDATE_ITEM,
+  STAT_UPDATE_TAB,
+  STAT_IDLE_SCREEN,     // showIdleScreen + wakeFromIdle
+  STAT_FLASH_RESET,
+  STAT_SITE_COUNT
+};
+void dumpDisplayStats();         // table over Serial, no-op in release
+void resetDisplayStats();
 
 
 #endif
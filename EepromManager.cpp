@@ -2,129 +2,348 @@
 #include <Wire.h>
 #include "InterlockManager.h"
 #include "MenuState.h"
-#include "ButtonManager.h"   // pollButtons()
-#include "EncoderManager.h"  // pollEncoder()
-#include "AuxManager.h"      // auxTick()
+#include "AuxManager.h"      // auxState
+#include "RecordStore.h"
+#include "TripLog.h"         // tripLogFlush(), tripLogAfterFormat()
+#include "Scheduler.h"       // schedulerYield()
 
 // ───── Internal Helpers ─────
-uint8_t eepromRead(uint32_t addr) {
-  uint8_t device = EEPROM_BASE_ADDR + ((addr >> 16) & 0x03);  // select bank
-  uint16_t wordAddr = addr & 0xFFFF;
+static uint8_t eepromDevice(uint32_t addr) {
+  return EEPROM_BASE_ADDR + ((addr >> 16) & 0x03);            // select bank
+}
 
-  Wire.beginTransmission(device);
-  Wire.write((wordAddr >> 8) & 0xFF);       // MSB
-  Wire.write(wordAddr & 0xFF);              // LSB
-  if (Wire.endTransmission(false) != 0) {
-    Serial.println("[EEPROM] Read: address NACK");
-    return 0xFF;
-  }
+// ACK polling: the chip NACKs its address while a write cycle runs.
+// Called before every access, so a write returns at once and the CPU
+// only waits if the next access comes before the cycle is over.  The
+// critical tasks get a turn here and between probes, so back-to-back
+// transfers never hold them off for more than one.
+static bool writePending = false;
 
-  Wire.requestFrom(device, (uint8_t)1);
-  if (!Wire.available()) {
-    Serial.println("[EEPROM] Read: no data received");
-    return 0xFF;
-  }
+static bool eepromWaitReady(uint8_t device) {
+  schedulerYield();
+  if (!writePending) return true;
+  const uint32_t t0 = micros();
+  do {
+    Wire.beginTransmission(device);
+    if (Wire.endTransmission() == 0) { writePending = false; return true; }
+    schedulerYield();
+  } while (micros() - t0 < EEPROM_WRITE_TIMEOUT_US);
+  Serial.println("[EEPROM] Busy: write cycle timeout");
+  return false;
+}
+
+bool eepromSync() {
+  return eepromWaitReady(EEPROM_BASE_ADDR);
+}
 
-  return Wire.read();
+// One ACK probe, never waits
+bool eepromReady() {
+  if (!writePending) return true;
+  Wire.beginTransmission(EEPROM_BASE_ADDR);
+  if (Wire.endTransmission() == 0) writePending = false;
+  return !writePending;
 }
 
-void eepromWrite(uint32_t addr, uint8_t data) {
-  uint8_t device = EEPROM_BASE_ADDR + ((addr >> 16) & 0x03);
+// Sequential read: one address phase per bank, then up to
+// EEPROM_READ_CHUNK bytes per request.  Each further request is a
+// current-address read, which carries on from the chip's own address
+// counter, so only a new bank (device) needs a new address phase.  The
+// bus is stopped between requests: the critical tasks run there, and
+// their expander reads leave the EEPROM's counter alone.
+bool eepromReadBlock(uint32_t addr, void* dst, uint32_t len) {
+  uint8_t* p = (uint8_t*)dst;
+  while (len) {
+    const uint32_t bankRoom = 0x10000 - (addr & 0xFFFF);
+    uint32_t seg = len < bankRoom ? len : bankRoom;
+
+    uint8_t device = eepromDevice(addr);
+    uint16_t wordAddr = addr & 0xFFFF;
+
+    eepromWaitReady(device);
+    Wire.beginTransmission(device);
+    Wire.write((wordAddr >> 8) & 0xFF);     // MSB
+    Wire.write(wordAddr & 0xFF);            // LSB
+    if (Wire.endTransmission(false) != 0) {
+      Serial.println("[EEPROM] Read: address NACK");
+      memset(p, 0xFF, len);
+      return false;
+    }
+    addr += seg;
+    len  -= seg;
+    while (seg) {
+      const uint8_t n = seg > EEPROM_READ_CHUNK ? EEPROM_READ_CHUNK : seg;
+      if (Wire.requestFrom(device, n) != n) {
+        Serial.println("[EEPROM] Read: short transfer");
+        memset(p, 0xFF, seg + len);
+        return false;
+      }
+      for (uint8_t i = 0; i < n; ++i) *p++ = Wire.read();
+      seg -= n;
+      if (seg || len) schedulerYield();
+    }
+  }
+  return true;
+}
+
+// One write transaction.  Clipped to the page (and hence the bank) and
+// to the Wire TX buffer; returns the number of bytes taken.
+uint16_t eepromWritePage(uint32_t addr, const uint8_t* data, uint16_t len) {
+  const uint16_t room = EEPROM_PAGE_SIZE - (addr % EEPROM_PAGE_SIZE);
+  if (len > room)               len = room;
+  if (len > EEPROM_WRITE_CHUNK) len = EEPROM_WRITE_CHUNK;
+
+  uint8_t device = eepromDevice(addr);
   uint16_t wordAddr = addr & 0xFFFF;
 
+  eepromWaitReady(device);
   Wire.beginTransmission(device);
   Wire.write((wordAddr >> 8) & 0xFF);
   Wire.write(wordAddr & 0xFF);
-  Wire.write(data);
+  Wire.write(data, len);
   if (Wire.endTransmission() != 0) {
     Serial.println("[EEPROM] Write: address NACK");
+  } else {
+    writePending = true;        // next access ACK-polls first
   }
-
-  delay(6);  // mandatory EEPROM write delay
+  return len;
 }
 
-void eepromChipErase()
-{
-  for (uint32_t a = 0; a < EEPROM_TOTAL_SIZE; a += EEPROM_PAGE_SIZE)
-  {
-      for (uint16_t i = 0; i < EEPROM_PAGE_SIZE; ++i)
-          eepromWrite(a + i, 0xFF);
-      delay(30);                // let I²C settle / yield to USB
-      pollButtons();           // keep UI responsive
-      pollEncoder();           //  –– » ––
-      auxTick();               //
-      delay(30);                // let I²C settle / yield to USB
-      loadOverviewSettings();
+// Any length: split into page writes, each its own write cycle
+void eepromWriteBlock(uint32_t addr, const void* src, uint32_t len) {
+  const uint8_t* p = (const uint8_t*)src;
+  while (len) {
+    const uint16_t n = eepromWritePage(addr, p, len > 0xFFFF ? 0xFFFF : len);
+    addr += n;
+    p    += n;
+    len  -= n;
   }
 }
 
-// ───── Public Interface ─────
-void initEeprom() {
-  Wire.begin();
+static RecordStore settingsStore(SETTINGS_STORE_ADDR, SETTINGS_STORE_SLOTS,
+                                 SETTINGS_SLOT_SIZE, SETTINGS_VERSION);
+
+// ───── Packed on-EEPROM layouts (little-endian, like the SAMD) ─────
+// Payload of one settings record.  Changing it means bumping
+// SETTINGS_VERSION: records of another version read as absent.
+struct __attribute__((packed)) SettingsRecord {
+  uint8_t  state[INTERLOCK_COUNT];      // 0 input, 1 sim ON, 2 sim OFF
+  uint8_t  autoResetEnable;
+  uint16_t autoResetDelay;              // 0-1000 ms
+};
+static_assert(sizeof(SettingsRecord) <= SETTINGS_SLOT_SIZE - RecordStore::OVERHEAD,
+              "settings record does not fit a slot");
+static_assert(SETTINGS_SLOT_SIZE <= RecordStore::MAX_SLOT,
+              "settings slot exceeds RecordStore's stack buffer");
+static_assert(EEPROM_PAGE_SIZE % SETTINGS_SLOT_SIZE == 0 && SETTINGS_STORE_ADDR % EEPROM_PAGE_SIZE == 0,
+              "settings slots must not cross a page");
+
+struct __attribute__((packed)) LegacyOverviewConfig {
+  uint8_t  flag;                        // LEGACY_OVERVIEW_FLAG
+  uint8_t  state[INTERLOCK_COUNT];
+};
+
+struct __attribute__((packed)) LegacyAuxConfig {
+  uint8_t  flag;                        // LEGACY_AUX_FLAG
+  uint8_t  autoResetEnable;
+  uint16_t autoResetDelay;
+};
+
+// RAM image of the newest record; a save updates its half and appends
+// the whole record, so Overview and Aux saves never clobber each other
+static SettingsRecord settings;
+static bool haveSettings = false;
+
+static void appendSettings() {
+  settingsStore.append(&settings, sizeof(settings));   // one page write
+  haveSettings = true;
 }
 
-void saveOverviewSettings() {
-  Serial.println("[EEPROM] Saving overview settings...");
+// Write-behind: a save only updates the RAM image and marks it dirty;
+// serviceSettings() appends one record once the edits have settled, so
+// a burst of edits (or the same item edited back and forth) costs one
+// record, and none at all if the image ends up unchanged.
+static SettingsRecord stored;            // image of the newest record
+static bool     dirty   = false;
+static uint32_t dirtyMs = 0;
 
-  // Write validity flag
-  eepromWrite(OVERVIEW_CONFIG_ADDR, OVERVIEW_VALID_FLAG);
+static void markDirty() {
+  dirty   = true;
+  dirtyMs = millis();
+}
 
-  // Write state for each of the 8 interlocks (change if you need 9)
-  for (uint8_t i = 0; i < 8; ++i) {
-    uint8_t state = 0;  // default = input
+static void writeIfChanged() {
+  dirty = false;
+  if (haveSettings && !memcmp(&settings, &stored, sizeof(settings))) return;
+  appendSettings();
+  stored = settings;
+  Serial.print("[EEPROM] Settings #"); Serial.print(settingsStore.sequence());
+  Serial.println(" saved");
+}
 
-    if (isSimulated(interlocks[i].port, interlocks[i].bit)) {
-      bool out = (readOutputRegister(interlocks[i].port) >> interlocks[i].bit) & 1;
-      state = out ? 2 : 1;
-    }
+// First boot on the store: carry over the fixed-address configs
+static void importLegacySettings() {
+  LegacyOverviewConfig ov;
+  LegacyAuxConfig aux;
+  const bool haveOv  = eepromReadBlock(LEGACY_OVERVIEW_ADDR, &ov, sizeof(ov)) &&
+                       ov.flag == LEGACY_OVERVIEW_FLAG;
+  const bool haveAux = eepromReadBlock(LEGACY_AUX_ADDR, &aux, sizeof(aux)) &&
+                       aux.flag == LEGACY_AUX_FLAG;
+  if (!haveOv && !haveAux) return;
 
-    eepromWrite(OVERVIEW_CONFIG_ADDR + 1 + i, state);
-    Serial.print("[EEPROM] Stored item "); Serial.print(i);
-    Serial.print(" with state "); Serial.println(state);
+  if (haveOv) memcpy(settings.state, ov.state, sizeof(settings.state));
+  if (haveAux) {
+    settings.autoResetEnable = aux.autoResetEnable;
+    settings.autoResetDelay  = aux.autoResetDelay;
   }
+  Serial.println("[EEPROM] Imported fixed-address config");
+  appendSettings();
+  stored = settings;
 }
 
-void loadOverviewSettings() {
-  Serial.println("[EEPROM] Loading overview settings...");
+// ───── Public Interface ─────
+void initEeprom() {
+  Wire.begin();
 
-  uint8_t flag = eepromRead(OVERVIEW_CONFIG_ADDR);
-  Serial.print("[EEPROM] Read flag: 0x");
-  Serial.println(flag, HEX);
+  memset(settings.state, 0, sizeof(settings.state));
+  settings.autoResetEnable = auxState.autoResetEnable ? 1 : 0;
+  settings.autoResetDelay  = auxState.autoResetDelay;
 
-  if (flag != OVERVIEW_VALID_FLAG) {
-    Serial.println("[EEPROM] No valid config found. Skipping load.");
-    return;
+  if (!settingsStore.begin()) {
+    importLegacySettings();
+  } else if (settingsStore.load(&settings, sizeof(settings))) {
+    haveSettings = true;
+    stored = settings;
+    Serial.print("[EEPROM] Settings #"); Serial.print(settingsStore.sequence());
+    Serial.print(" in slot "); Serial.println(settingsStore.headSlot());
   }
+}
+
+void saveOverviewItem(uint8_t idx) {
+  if (idx >= INTERLOCK_COUNT) return;
+  settings.state[idx] = editStateOfItem(idx);   // shadow registers, no bus
+  markDirty();
+}
+
+void serviceSettings() {
+  if (!dirty || millis() - dirtyMs < SETTINGS_SETTLE_MS) return;
+  if (eepromFormatBusy()) return;        // would be erased again
+  if (!eepromReady()) return;            // a write cycle is running: next time
+  writeIfChanged();
+}
 
-  Serial.println("[EEPROM] Valid config found. Applying states...");
+void settingsFlush() {
+  if (dirty) writeIfChanged();
+  eepromSync();
+}
 
-  for (uint8_t i = 0; i < 8; ++i) {
-    uint8_t state = eepromRead(OVERVIEW_CONFIG_ADDR + 1 + i);
-    Serial.print("[EEPROM] Item "); Serial.print(i);
-    Serial.print(" → EEPROM state: "); Serial.println(state);
+void eepromFlushAll() {
+  settingsFlush();
+  tripLogFlush();
+}
 
-    applyEditStateToItem(i, state);
+void loadOverviewSettings() {
+  if (!haveSettings) {
+    Serial.println("[EEPROM] No valid config found. Skipping load.");
+    return;
   }
+  applyEditStates(settings.state);       // ≤ 4 expander writes
 }
 /* ───── Aux-tab autoreset persistence ───── */
 void saveAuxSettings()
 {
-    eepromWrite(AUX_CONFIG_ADDR, AUX_VALID_FLAG);
-    eepromWrite(AUX_CONFIG_ADDR + 1, auxState.autoResetEnable ? 1 : 0);
-
-    uint16_t ms = auxState.autoResetDelay;        // 0-1000 ms
-    eepromWrite(AUX_CONFIG_ADDR + 2, ms & 0xFF);  // LSB
-    eepromWrite(AUX_CONFIG_ADDR + 3, ms >> 8);    // MSB
+    settings.autoResetEnable = auxState.autoResetEnable ? 1 : 0;
+    settings.autoResetDelay  = auxState.autoResetDelay;
+    markDirty();
 }
 
 void loadAuxSettings()
 {
-    if (eepromRead(AUX_CONFIG_ADDR) != AUX_VALID_FLAG) return;   // nothing saved
+    if (!haveSettings) return;                                   // nothing saved
+
+    auxState.autoResetEnable = settings.autoResetEnable != 0;
+    auxState.autoResetDelay  = settings.autoResetDelay;
+}
 
-    auxState.autoResetEnable = eepromRead(AUX_CONFIG_ADDR + 1) != 0;
+/* ───── Background format ───── */
+// One bus transaction per task run: a FORMAT_STEP read, and when the
+// chunk is not already blank, its write on the next run.  The settings and trip-log writers hold
+// off while it runs; at the end (or on cancel) both re-find their heads.
+static bool     formatActive = false;
+static uint32_t formatAddr   = 0;
+static bool     formatErase  = false;   // chunk at formatAddr read dirty
+static uint16_t formatWrites = 0;
+static uint32_t formatT0     = 0;
 
-    uint16_t lsb = eepromRead(AUX_CONFIG_ADDR + 2);
-    uint16_t msb = eepromRead(AUX_CONFIG_ADDR + 3);
-    auxState.autoResetDelay  = (msb << 8) | lsb;
+// the job stopped inside [start, start + size): part erased, part not
+static bool cutInto(uint32_t start, uint32_t size) {
+  return formatAddr > start && formatAddr < start + size;
 }
 
+static void endFormat() {
+  formatActive = false;
+
+  // A cut store still holds older records above the cut.  Starting over
+  // at seq 1 would let them pass the head search again, so the current
+  // settings go to slot 0 at once, numbered above everything left.
+  if (cutInto(SETTINGS_STORE_ADDR, SETTINGS_STORE_SLOTS * SETTINGS_SLOT_SIZE) &&
+      settingsStore.sequence()) {
+    settingsStore.restartAfter(settingsStore.sequence());
+    appendSettings();
+    stored = settings;
+    dirty  = false;
+  } else if (formatAddr >= SETTINGS_STORE_ADDR + SETTINGS_STORE_SLOTS * SETTINGS_SLOT_SIZE) {
+    settingsStore.reset();               // all blank: nothing to search
+    haveSettings = false;
+  } else {
+    haveSettings = settingsStore.begin() && settingsStore.load(&stored, sizeof(stored));
+  }
+  tripLogAfterFormat(cutInto(TRIP_LOG_ADDR, TRIP_LOG_SIZE));
+
+  const uint32_t ms = millis() - formatT0;
+  Serial.print(formatAddr < EEPROM_TOTAL_SIZE ? "[EEPROM] Format cancelled at " : "[EEPROM] Formatted ");
+  Serial.print(formatAddr / 1024); Serial.print(" KB in "); Serial.print(ms);
+  Serial.print(" ms, "); Serial.print(formatWrites); Serial.print(" of ");
+  Serial.print(formatAddr / FORMAT_STEP); Serial.println(" chunks written");
+}
+
+bool eepromFormatStart() {
+  if (formatActive) return false;
+  formatActive = true;
+  formatAddr   = 0;
+  formatErase  = false;
+  formatWrites = 0;
+  formatT0     = millis();
+  return true;
+}
+
+void eepromFormatCancel() {
+  if (formatActive) endFormat();
+}
+
+bool eepromFormatBusy() {
+  return formatActive;
+}
+
+uint8_t eepromFormatPercent() {
+  return (uint64_t)formatAddr * 100 / EEPROM_TOTAL_SIZE;
+}
+
+void serviceFormat() {
+  if (!formatActive || !eepromReady()) return;
+  if (formatAddr >= EEPROM_TOTAL_SIZE) { endFormat(); return; }   // head searches: a run of their own
+
+  uint8_t buf[FORMAT_STEP];
+  bool done = true;
+  if (formatErase) {
+    memset(buf, 0xFF, FORMAT_STEP);
+    eepromWritePage(formatAddr, buf, FORMAT_STEP);   // one write cycle
+    formatWrites++;
+    formatErase = false;
+  } else {
+    bool blank = eepromReadBlock(formatAddr, buf, FORMAT_STEP);
+    for (uint16_t i = 0; blank && i < FORMAT_STEP; ++i) blank = buf[i] == 0xFF;
+    formatErase = !blank;
+    done = blank;
+  }
+  if (done) formatAddr += FORMAT_STEP;
+}
@@ -1,27 +1,59 @@
 #ifndef EEPROM_MANAGER_H
 #define EEPROM_MANAGER_H
-#define AUX_CONFIG_ADDR   0x0100      // 3 bytes reserved
-#define AUX_VALID_FLAG    0x5A
-
 #include <Arduino.h>
 
 #define EEPROM_BASE_ADDR      0x50
 #define EEPROM_TOTAL_SIZE     0x40000
 #define EEPROM_PAGE_SIZE      256
-
-#define OVERVIEW_CONFIG_ADDR  0x0000
-#define OVERVIEW_VALID_FLAG   0xA5
+// One transaction holds the bus ~90 us per byte at 100 kHz and cannot be
+// interrupted; between transactions the helpers run schedulerYield(), so
+// an interlock edge waits at most one 32-byte transfer (~3.3 ms)
+#define EEPROM_WRITE_CHUNK    32      // data bytes per write transaction
+#define EEPROM_READ_CHUNK     32      // bytes per sequential read request
+#define EEPROM_WRITE_TIMEOUT_US 10000 // ACK polling gives up after t_WR max + margin
+
+// Settings record store (RecordStore.h): 128 slots of 32 bytes
+#define SETTINGS_STORE_ADDR   0x1000
+#define SETTINGS_STORE_SLOTS  128
+#define SETTINGS_SLOT_SIZE    32
+#define SETTINGS_VERSION      1
+
+// Trip log ring (TripLog.h): 16-byte records up to the end of the chip
+#define TRIP_LOG_ADDR         0x2000
+#define TRIP_LOG_SIZE         (EEPROM_TOTAL_SIZE - TRIP_LOG_ADDR)
+
+// Fixed-address configs of older firmware, imported once into the store
+#define LEGACY_OVERVIEW_ADDR  0x0000
+#define LEGACY_OVERVIEW_FLAG  0xA5
+#define LEGACY_AUX_ADDR       0x0100
+#define LEGACY_AUX_FLAG       0x5A
+
+#define SETTINGS_SETTLE_MS    300     // edits this close together share one record
 
 void initEeprom();
 void loadOverviewSettings();
-void saveOverviewSettings();
-
-uint8_t eepromRead(uint32_t addr);
-void    eepromWrite(uint32_t addr,uint8_t data);
-void    eepromChipErase();
+void saveOverviewItem(uint8_t idx);   // mark dirty; serviceSettings() writes
+void serviceSettings();               // scheduler task: at most one record
+void settingsFlush();                 // write pending settings now and wait
+void eepromFlushAll();                // settings + trip log, before a reset
+
+uint16_t eepromWritePage(uint32_t addr,const uint8_t* data,uint16_t len); // returns bytes taken
+bool    eepromReadBlock(uint32_t addr,void* dst,uint32_t len);      // sequential read
+void    eepromWriteBlock(uint32_t addr,const void* src,uint32_t len); // page writes
+bool    eepromSync();                                             // wait out the last write cycle
+bool    eepromReady();                                            // no write cycle running
 void  saveAuxSettings();
 void  loadAuxSettings();
 
+// Format as a background job: serviceFormat() reads one chunk, or
+// blanks it, per call - one ~3 ms bus transaction at 100 kHz
+#define FORMAT_STEP           32
+bool    eepromFormatStart();          // false if one is running
+void    eepromFormatCancel();
+bool    eepromFormatBusy();
+uint8_t eepromFormatPercent();        // 0-100
+void    serviceFormat();              // scheduler task
+
 #endif
 
 
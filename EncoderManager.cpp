@@ -54,6 +54,7 @@ void pollEncoder() {
 
   // scrolling
   uint8_t count = itemCountForTab(menuState.currentTab);
+  if (count == 0) return;                 // Log tab: nothing to select
   if (d > 0 && menuState.selectedItem + 1 < count) {
     menuState.selectedItem++;
     updateItem();
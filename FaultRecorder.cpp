@@ -0,0 +1,73 @@
+#include "FaultRecorder.h"
+#include "InterlockManager.h"
+
+/* runs from the INT service path: only bookkeeping, no bus, no display */
+
+static FaultEntry entries[FAULT_LOG_SIZE];
+static uint8_t    entryCount = 0;
+static bool       latched    = false;
+static uint32_t   t0Us       = 0;
+static uint8_t    nextRank   = 1;
+static uint8_t    rank[INTERLOCK_COUNT];             // per channel, 0 = none
+static uint32_t   firstUs[INTERLOCK_COUNT];
+
+/* the "Reset" row is the pulse output, not a fault input */
+static bool isFaultChannel(uint8_t i) { return interlocks[i].allowSim; }
+
+static void onChange(const InterlockEvent& ev)
+{
+  const uint16_t diff = ev.before ^ ev.after;
+  bool newTrip = false;
+
+  for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i) {
+    if (!isFaultChannel(i)) continue;
+    const uint16_t m = interlocks[i].mask();
+    if (!(diff & m)) continue;
+
+    const bool tripped = !(ev.after & m);          // active LOW
+    if (!latched) {
+      if (!tripped) continue;                      // releases before a trip
+      latched = true;
+      t0Us    = ev.us;
+    }
+    if (entryCount < FAULT_LOG_SIZE)
+      entries[entryCount++] = { i, tripped, ev.us - t0Us };
+    if (tripped && !rank[i]) {
+      rank[i]    = nextRank;                       // same burst → same rank
+      firstUs[i] = ev.us - t0Us;
+      newTrip    = true;
+    }
+  }
+  if (newTrip) nextRank++;
+}
+
+void initFaultRecorder()
+{
+  addInterlockListener(onChange);
+}
+
+bool faultLatched()                  { return latched; }
+uint8_t faultRank(uint8_t idx)       { return idx < INTERLOCK_COUNT ? rank[idx] : 0; }
+uint32_t faultDelayUs(uint8_t idx)   { return idx < INTERLOCK_COUNT ? firstUs[idx] : 0; }
+
+void dumpFaults()
+{
+  char line[64];
+  Serial.print("[FAULT] "); Serial.print(entryCount);
+  Serial.println(latched ? " transitions latched" : " transitions, none latched");
+  for (uint8_t n = 0; n < entryCount; ++n) {
+    const FaultEntry& e = entries[n];
+    snprintf(line, sizeof(line), "[FAULT] %2u  %-10s %-7s +%lu us  rank %u",
+             n + 1, interlocks[e.channel].label, e.tripped ? "trip" : "release",
+             (unsigned long)e.dtUs, rank[e.channel]);
+    Serial.println(line);
+  }
+}
+
+void acknowledgeFaults()
+{
+  latched    = false;
+  entryCount = 0;
+  nextRank   = 1;
+  for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i) { rank[i] = 0; firstUs[i] = 0; }
+}
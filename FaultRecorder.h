@@ -0,0 +1,28 @@
+#ifndef FAULT_RECORDER_H
+#define FAULT_RECORDER_H
+
+#include <Arduino.h>
+
+/* ────────────────────────────────────────────
+   First-fault recorder.  The first trip of any
+   interlock channel starts a sequence; every
+   later transition is latched with its time
+   relative to that first edge until the
+   operator acknowledges.                      */
+
+#define FAULT_LOG_SIZE  16
+
+struct FaultEntry {
+  uint8_t  channel;    // index into interlocks[]
+  bool     tripped;    // true = went active (LOW)
+  uint32_t dtUs;       // since the first fault's INT edge
+};
+
+void     initFaultRecorder();          // before initDisplay(): listener order
+bool     faultLatched();               // a sequence is being held
+uint8_t  faultRank(uint8_t idx);       // 1 = tripped first, 0 = not in sequence
+uint32_t faultDelayUs(uint8_t idx);    // first trip of idx after the first fault
+void     acknowledgeFaults();          // clear and re-arm
+void     dumpFaults();                 // latched sequence to Serial
+
+#endif
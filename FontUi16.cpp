@@ -0,0 +1,302 @@
+// FontUi16.cpp - generated by tools/fontconv.py, do not edit
+// source: DejaVuSans-Bold.ttf @ 16 px, 100 glyphs, 3008 run bytes
+
+#include "RleFont.h"
+
+static const uint8_t fontUi16Runs[] PROGMEM = {
+    0x71, 0x16, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03,
+    0x82, 0x0A, 0x82, 0x03, 0x82, 0x03, 0x82, 0x1D, 0x19, 0x80, 0x01, 0x81, 0x01, 0x82, 0x00, 0x81,
+    0x01, 0x82, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x02, 0x80, 0x01, 0x81, 0x58, 0x2C, 0x80, 0x0A,
+    0x81, 0x01, 0x81, 0x06, 0x81, 0x01, 0x80, 0x04, 0x89, 0x02, 0x89, 0x04, 0x81, 0x01, 0x81, 0x06,
+    0x81, 0x01, 0x80, 0x04, 0x89, 0x02, 0x8A, 0x03, 0x81, 0x01, 0x81, 0x06, 0x81, 0x01, 0x80, 0x07,
+    0x80, 0x01, 0x81, 0x38, 0x25, 0x80, 0x09, 0x80, 0x06, 0x86, 0x02, 0x87, 0x02, 0x82, 0x00, 0x80,
+    0x05, 0x84, 0x06, 0x86, 0x05, 0x85, 0x05, 0x80, 0x00, 0x82, 0x05, 0x80, 0x00, 0x82, 0x01, 0x88,
+    0x02, 0x86, 0x06, 0x80, 0x09, 0x80, 0x1A, 0x31, 0x82, 0x05, 0x80, 0x04, 0x84, 0x03, 0x81, 0x04,
+    0x81, 0x01, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x01, 0x81, 0x05, 0x81, 0x01, 0x81, 0x00,
+    0x81, 0x06, 0x84, 0x01, 0x80, 0x09, 0x80, 0x02, 0x81, 0x00, 0x83, 0x07, 0x81, 0x01, 0x81, 0x00,
+    0x81, 0x06, 0x81, 0x00, 0x81, 0x01, 0x82, 0x04, 0x81, 0x01, 0x81, 0x01, 0x82, 0x03, 0x81, 0x03,
+    0x81, 0x00, 0x81, 0x04, 0x81, 0x03, 0x84, 0x40, 0x2D, 0x84, 0x07, 0x86, 0x06, 0x82, 0x0A, 0x82,
+    0x0A, 0x82, 0x09, 0x84, 0x02, 0x82, 0x01, 0x86, 0x01, 0x82, 0x01, 0x82, 0x01, 0x85, 0x02, 0x82,
+    0x02, 0x84, 0x02, 0x82, 0x02, 0x83, 0x04, 0x89, 0x04, 0x89, 0x38, 0x10, 0x80, 0x02, 0x82, 0x01,
+    0x82, 0x01, 0x82, 0x02, 0x80, 0x38, 0x17, 0x82, 0x03, 0x81, 0x03, 0x82, 0x03, 0x82, 0x03, 0x81,
+    0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x04, 0x81, 0x04, 0x82, 0x03, 0x82, 0x04, 0x81,
+    0x04, 0x82, 0x0E, 0x16, 0x81, 0x04, 0x82, 0x03, 0x82, 0x04, 0x81, 0x04, 0x82, 0x03, 0x82, 0x03,
+    0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x81, 0x03, 0x82, 0x03, 0x82, 0x03, 0x81, 0x10,
+    0x1A, 0x81, 0x05, 0x81, 0x03, 0x86, 0x01, 0x83, 0x03, 0x84, 0x01, 0x80, 0x00, 0x81, 0x00, 0x81,
+    0x02, 0x81, 0x4A, 0x46, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x06, 0x89, 0x02, 0x89, 0x06,
+    0x81, 0x0A, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x38, 0x49, 0x82, 0x02, 0x82, 0x02, 0x81, 0x02, 0x82,
+    0x02, 0x81, 0x0E, 0x3F, 0x84, 0x01, 0x84, 0x01, 0x83, 0x32, 0x49, 0x82, 0x02, 0x82, 0x02, 0x82,
+    0x18, 0x15, 0x81, 0x03, 0x80, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x81, 0x03, 0x81, 0x03,
+    0x81, 0x03, 0x80, 0x03, 0x81, 0x03, 0x81, 0x03, 0x80, 0x03, 0x81, 0x03, 0x80, 0x10, 0x24, 0x83,
+    0x04, 0x86, 0x02, 0x83, 0x00, 0x83, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x02, 0x86, 0x04, 0x84, 0x2E, 0x23, 0x83, 0x05, 0x85, 0x04, 0x85, 0x06, 0x83, 0x06,
+    0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x04, 0x87, 0x02, 0x87, 0x2C,
+    0x22, 0x85, 0x03, 0x87, 0x02, 0x81, 0x02, 0x82, 0x08, 0x82, 0x07, 0x82, 0x06, 0x82, 0x06, 0x82,
+    0x06, 0x82, 0x06, 0x82, 0x06, 0x82, 0x06, 0x88, 0x01, 0x88, 0x2C, 0x22, 0x85, 0x03, 0x87, 0x03,
+    0x80, 0x02, 0x83, 0x06, 0x83, 0x06, 0x82, 0x04, 0x84, 0x05, 0x85, 0x07, 0x83, 0x07, 0x82, 0x01,
+    0x80, 0x03, 0x83, 0x01, 0x87, 0x02, 0x86, 0x2E, 0x25, 0x83, 0x06, 0x83, 0x05, 0x84, 0x04, 0x81,
+    0x00, 0x82, 0x04, 0x81, 0x00, 0x82, 0x03, 0x81, 0x01, 0x82, 0x02, 0x81, 0x02, 0x82, 0x02, 0x81,
+    0x02, 0x82, 0x02, 0x89, 0x00, 0x88, 0x06, 0x82, 0x07, 0x82, 0x2D, 0x22, 0x86, 0x03, 0x86, 0x03,
+    0x86, 0x03, 0x81, 0x08, 0x85, 0x04, 0x86, 0x03, 0x80, 0x02, 0x83, 0x07, 0x82, 0x07, 0x82, 0x01,
+    0x80, 0x03, 0x83, 0x01, 0x87, 0x03, 0x85, 0x2E, 0x24, 0x84, 0x04, 0x86, 0x02, 0x82, 0x06, 0x82,
+    0x07, 0x82, 0x00, 0x82, 0x03, 0x87, 0x02, 0x83, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x02, 0x81, 0x02, 0x82, 0x02, 0x87, 0x03, 0x85, 0x2D, 0x21, 0x88, 0x01, 0x88, 0x01,
+    0x88, 0x06, 0x82, 0x07, 0x82, 0x06, 0x82, 0x07, 0x82, 0x06, 0x82, 0x07, 0x82, 0x06, 0x82, 0x07,
+    0x82, 0x07, 0x82, 0x30, 0x23, 0x84, 0x04, 0x86, 0x02, 0x83, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82,
+    0x02, 0x82, 0x01, 0x82, 0x03, 0x85, 0x03, 0x86, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82,
+    0x01, 0x82, 0x02, 0x82, 0x01, 0x88, 0x02, 0x86, 0x2D, 0x23, 0x83, 0x05, 0x86, 0x02, 0x82, 0x01,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x88, 0x02,
+    0x87, 0x07, 0x82, 0x06, 0x82, 0x02, 0x87, 0x03, 0x85, 0x2E, 0x25, 0x81, 0x03, 0x82, 0x02, 0x82,
+    0x14, 0x82, 0x02, 0x82, 0x02, 0x82, 0x18, 0x25, 0x81, 0x03, 0x82, 0x02, 0x82, 0x14, 0x82, 0x02,
+    0x82, 0x02, 0x81, 0x02, 0x82, 0x02, 0x81, 0x0E, 0x56, 0x82, 0x06, 0x84, 0x04, 0x85, 0x05, 0x83,
+    0x08, 0x83, 0x09, 0x85, 0x09, 0x84, 0x0A, 0x82, 0x41, 0x5C, 0x89, 0x02, 0x89, 0x1C, 0x89, 0x02,
+    0x89, 0x4E, 0x4F, 0x82, 0x09, 0x84, 0x0A, 0x84, 0x0A, 0x83, 0x08, 0x83, 0x05, 0x84, 0x04, 0x84,
+    0x07, 0x82, 0x48, 0x1C, 0x84, 0x02, 0x86, 0x01, 0x81, 0x01, 0x82, 0x05, 0x82, 0x05, 0x82, 0x04,
+    0x82, 0x04, 0x82, 0x05, 0x82, 0x0E, 0x81, 0x06, 0x82, 0x05, 0x82, 0x26, 0x44, 0x86, 0x06, 0x82,
+    0x03, 0x82, 0x04, 0x82, 0x06, 0x81, 0x03, 0x81, 0x02, 0x81, 0x00, 0x80, 0x01, 0x80, 0x02, 0x81,
+    0x01, 0x85, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+    0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+    0x01, 0x81, 0x00, 0x81, 0x03, 0x80, 0x02, 0x86, 0x04, 0x81, 0x0E, 0x81, 0x05, 0x80, 0x07, 0x87,
+    0x09, 0x83, 0x15, 0x27, 0x83, 0x07, 0x83, 0x07, 0x84, 0x05, 0x85, 0x05, 0x82, 0x00, 0x82, 0x03,
+    0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x83, 0x01, 0x89, 0x01, 0x89, 0x01,
+    0x82, 0x04, 0x85, 0x05, 0x82, 0x2F, 0x25, 0x85, 0x04, 0x88, 0x02, 0x88, 0x02, 0x83, 0x01, 0x83,
+    0x01, 0x83, 0x01, 0x82, 0x02, 0x88, 0x02, 0x88, 0x02, 0x83, 0x02, 0x82, 0x01, 0x83, 0x02, 0x82,
+    0x01, 0x83, 0x02, 0x82, 0x01, 0x89, 0x01, 0x87, 0x32, 0x28, 0x84, 0x04, 0x87, 0x02, 0x83, 0x02,
+    0x81, 0x01, 0x83, 0x07, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x83, 0x08, 0x82, 0x04,
+    0x80, 0x02, 0x88, 0x04, 0x85, 0x31, 0x28, 0x85, 0x05, 0x88, 0x03, 0x89, 0x02, 0x83, 0x02, 0x83,
+    0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x83, 0x00, 0x83, 0x03, 0x83, 0x00, 0x83, 0x03, 0x82,
+    0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x89, 0x02, 0x87, 0x37, 0x22, 0x86, 0x02,
+    0x88, 0x01, 0x87, 0x02, 0x83, 0x06, 0x83, 0x06, 0x87, 0x02, 0x87, 0x02, 0x83, 0x06, 0x83, 0x06,
+    0x83, 0x06, 0x88, 0x01, 0x88, 0x2C, 0x22, 0x86, 0x02, 0x88, 0x01, 0x87, 0x02, 0x83, 0x06, 0x83,
+    0x06, 0x87, 0x02, 0x87, 0x02, 0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x06, 0x83, 0x31, 0x2B,
+    0x84, 0x05, 0x88, 0x02, 0x83, 0x02, 0x82, 0x01, 0x83, 0x08, 0x82, 0x09, 0x82, 0x03, 0x83, 0x01,
+    0x82, 0x02, 0x84, 0x01, 0x82, 0x03, 0x83, 0x01, 0x83, 0x03, 0x82, 0x02, 0x82, 0x03, 0x82, 0x02,
+    0x89, 0x04, 0x86, 0x35, 0x28, 0x81, 0x04, 0x82, 0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x82,
+    0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x82, 0x01, 0x8A, 0x01, 0x8A, 0x01, 0x83, 0x03, 0x82,
+    0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x82, 0x01, 0x83, 0x03, 0x82,
+    0x34, 0x13, 0x81, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,
+    0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x18, 0x13, 0x81, 0x02, 0x83, 0x01, 0x83,
+    0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83,
+    0x01, 0x83, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x08, 0x25, 0x81, 0x04, 0x82, 0x00, 0x83, 0x02,
+    0x82, 0x01, 0x83, 0x01, 0x82, 0x02, 0x83, 0x00, 0x82, 0x03, 0x86, 0x04, 0x85, 0x05, 0x85, 0x05,
+    0x86, 0x04, 0x83, 0x00, 0x82, 0x03, 0x83, 0x01, 0x82, 0x02, 0x83, 0x02, 0x82, 0x01, 0x83, 0x03,
+    0x82, 0x2F, 0x1F, 0x81, 0x06, 0x83, 0x05, 0x83, 0x05, 0x83, 0x05, 0x83, 0x05, 0x83, 0x05, 0x83,
+    0x05, 0x83, 0x05, 0x83, 0x05, 0x83, 0x05, 0x88, 0x00, 0x88, 0x27, 0x31, 0x82, 0x05, 0x82, 0x02,
+    0x84, 0x03, 0x84, 0x01, 0x84, 0x03, 0x84, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01,
+    0x82, 0x00, 0x89, 0x01, 0x82, 0x01, 0x83, 0x00, 0x83, 0x01, 0x82, 0x01, 0x83, 0x00, 0x83, 0x01,
+    0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x02, 0x81, 0x01, 0x83, 0x01, 0x82, 0x06, 0x83, 0x01,
+    0x82, 0x06, 0x83, 0x40, 0x28, 0x82, 0x03, 0x82, 0x01, 0x84, 0x02, 0x82, 0x01, 0x84, 0x02, 0x82,
+    0x01, 0x85, 0x01, 0x82, 0x01, 0x85, 0x01, 0x82, 0x01, 0x82, 0x00, 0x82, 0x00, 0x82, 0x01, 0x82,
+    0x01, 0x81, 0x00, 0x82, 0x01, 0x82, 0x01, 0x85, 0x01, 0x82, 0x02, 0x84, 0x01, 0x82, 0x02, 0x84,
+    0x01, 0x82, 0x03, 0x83, 0x01, 0x82, 0x03, 0x83, 0x34, 0x2D, 0x84, 0x07, 0x87, 0x04, 0x83, 0x01,
+    0x83, 0x02, 0x83, 0x03, 0x82, 0x02, 0x82, 0x04, 0x83, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x05,
+    0x82, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x04, 0x82, 0x03, 0x82, 0x02, 0x83, 0x03, 0x88, 0x05,
+    0x86, 0x3B, 0x25, 0x85, 0x04, 0x88, 0x02, 0x89, 0x01, 0x83, 0x02, 0x82, 0x01, 0x83, 0x02, 0x82,
+    0x01, 0x83, 0x01, 0x83, 0x01, 0x88, 0x02, 0x87, 0x03, 0x83, 0x07, 0x83, 0x07, 0x83, 0x07, 0x83,
+    0x36, 0x2D, 0x84, 0x07, 0x87, 0x04, 0x83, 0x01, 0x83, 0x02, 0x83, 0x03, 0x82, 0x02, 0x82, 0x04,
+    0x83, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x04,
+    0x82, 0x03, 0x82, 0x02, 0x83, 0x03, 0x88, 0x06, 0x85, 0x0A, 0x82, 0x0B, 0x82, 0x1E, 0x25, 0x85,
+    0x04, 0x88, 0x02, 0x88, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x82, 0x02, 0x88, 0x02, 0x87,
+    0x03, 0x88, 0x02, 0x83, 0x01, 0x82, 0x02, 0x83, 0x02, 0x82, 0x01, 0x83, 0x02, 0x82, 0x01, 0x83,
+    0x02, 0x83, 0x2F, 0x26, 0x85, 0x04, 0x87, 0x02, 0x83, 0x01, 0x82, 0x02, 0x82, 0x08, 0x83, 0x08,
+    0x86, 0x05, 0x86, 0x07, 0x83, 0x08, 0x82, 0x02, 0x81, 0x03, 0x82, 0x02, 0x88, 0x03, 0x86, 0x32,
+    0x20, 0x9F, 0x04, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82,
+    0x07, 0x82, 0x07, 0x82, 0x2F, 0x28, 0x81, 0x04, 0x81, 0x02, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02,
+    0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02,
+    0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02, 0x82, 0x03, 0x82, 0x02, 0x82, 0x03, 0x88, 0x04,
+    0x86, 0x36, 0x23, 0x82, 0x05, 0x86, 0x04, 0x82, 0x00, 0x82, 0x03, 0x83, 0x00, 0x82, 0x03, 0x82,
+    0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x04, 0x82, 0x00, 0x82,
+    0x04, 0x85, 0x05, 0x85, 0x06, 0x84, 0x06, 0x83, 0x33, 0x36, 0x81, 0x03, 0x82, 0x03, 0x82, 0x01,
+    0x82, 0x02, 0x83, 0x02, 0x82, 0x01, 0x82, 0x02, 0x83, 0x02, 0x82, 0x01, 0x82, 0x02, 0x83, 0x02,
+    0x81, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x03, 0x82, 0x00, 0x81, 0x00, 0x82, 0x00, 0x82, 0x03,
+    0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x03, 0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x04,
+    0x85, 0x01, 0x84, 0x05, 0x83, 0x02, 0x84, 0x05, 0x83, 0x03, 0x83, 0x05, 0x83, 0x03, 0x83, 0x4A,
+    0x24, 0x82, 0x04, 0x82, 0x00, 0x82, 0x03, 0x82, 0x02, 0x82, 0x01, 0x82, 0x04, 0x82, 0x00, 0x82,
+    0x04, 0x85, 0x06, 0x83, 0x07, 0x83, 0x06, 0x85, 0x05, 0x86, 0x03, 0x82, 0x01, 0x82, 0x02, 0x83,
+    0x02, 0x82, 0x01, 0x82, 0x04, 0x82, 0x2F, 0x23, 0x82, 0x04, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01,
+    0x83, 0x01, 0x82, 0x03, 0x82, 0x00, 0x83, 0x04, 0x85, 0x05, 0x84, 0x07, 0x83, 0x07, 0x82, 0x08,
+    0x82, 0x08, 0x82, 0x08, 0x82, 0x08, 0x82, 0x34, 0x24, 0x89, 0x01, 0x89, 0x01, 0x88, 0x07, 0x83,
+    0x06, 0x83, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x83, 0x07, 0x89, 0x01, 0x89,
+    0x30, 0x15, 0x84, 0x01, 0x84, 0x01, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03,
+    0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x84, 0x01, 0x84, 0x0E, 0x11, 0x81,
+    0x03, 0x81, 0x04, 0x80, 0x04, 0x81, 0x03, 0x81, 0x04, 0x80, 0x04, 0x81, 0x03, 0x81, 0x04, 0x80,
+    0x04, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x81, 0x03, 0x80, 0x0C, 0x15, 0x84, 0x01, 0x84, 0x03,
+    0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03,
+    0x82, 0x03, 0x82, 0x01, 0x84, 0x01, 0x84, 0x0E, 0x2C, 0x81, 0x09, 0x83, 0x07, 0x85, 0x05, 0x81,
+    0x02, 0x82, 0x03, 0x81, 0x05, 0x80, 0x7F, 0x10, 0x7F, 0x07, 0x8F, 0x10, 0x81, 0x06, 0x81, 0x06,
+    0x81, 0x72, 0x43, 0x85, 0x03, 0x87, 0x07, 0x82, 0x04, 0x86, 0x01, 0x88, 0x01, 0x82, 0x02, 0x82,
+    0x01, 0x82, 0x01, 0x83, 0x01, 0x88, 0x02, 0x83, 0x00, 0x82, 0x2C, 0x21, 0x82, 0x07, 0x82, 0x07,
+    0x82, 0x07, 0x82, 0x00, 0x83, 0x02, 0x88, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x03, 0x82, 0x00,
+    0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x82, 0x00, 0x83, 0x01, 0x82, 0x01, 0x88, 0x01, 0x82, 0x00,
+    0x83, 0x2D, 0x38, 0x84, 0x02, 0x86, 0x00, 0x83, 0x04, 0x82, 0x05, 0x82, 0x05, 0x82, 0x05, 0x82,
+    0x06, 0x86, 0x02, 0x84, 0x24, 0x27, 0x82, 0x07, 0x82, 0x07, 0x82, 0x03, 0x82, 0x00, 0x82, 0x02,
+    0x87, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02,
+    0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x88, 0x02, 0x87, 0x2C, 0x44, 0x84, 0x04, 0x86, 0x02, 0x82,
+    0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x88, 0x01, 0x88, 0x01, 0x82, 0x08, 0x87, 0x03, 0x85,
+    0x2D, 0x17, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x8D, 0x01, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03,
+    0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x1D, 0x44, 0x82, 0x00, 0x82, 0x02, 0x87, 0x01, 0x82,
+    0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x02, 0x87, 0x03, 0x82, 0x00, 0x82, 0x07, 0x82, 0x02, 0x87, 0x02, 0x86, 0x05, 0x81,
+    0x04, 0x21, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x00, 0x83, 0x02, 0x88, 0x01, 0x83, 0x01,
+    0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02,
+    0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x2C, 0x0F, 0x82, 0x01, 0x82, 0x06, 0x82,
+    0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82,
+    0x14, 0x0F, 0x82, 0x01, 0x82, 0x06, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01,
+    0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x00, 0x83, 0x00, 0x82, 0x01, 0x80, 0x03,
+    0x21, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82,
+    0x00, 0x82, 0x03, 0x85, 0x04, 0x85, 0x04, 0x86, 0x03, 0x82, 0x00, 0x83, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x02, 0x82, 0x2C, 0x0F, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01,
+    0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x14, 0x66, 0x82,
+    0x00, 0x82, 0x02, 0x82, 0x03, 0x8D, 0x02, 0x83, 0x00, 0x84, 0x00, 0x82, 0x02, 0x82, 0x02, 0x82,
+    0x01, 0x83, 0x01, 0x82, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82,
+    0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x02, 0x82, 0x01, 0x83,
+    0x44, 0x42, 0x82, 0x00, 0x83, 0x02, 0x88, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01,
+    0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01,
+    0x82, 0x02, 0x82, 0x2C, 0x44, 0x84, 0x04, 0x86, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82,
+    0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x88, 0x03, 0x84,
+    0x2E, 0x42, 0x82, 0x00, 0x83, 0x02, 0x88, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x03, 0x82, 0x00,
+    0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x82, 0x00, 0x83, 0x01, 0x82, 0x01, 0x88, 0x01, 0x82, 0x00,
+    0x83, 0x02, 0x82, 0x07, 0x82, 0x07, 0x82, 0x11, 0x44, 0x82, 0x00, 0x82, 0x02, 0x87, 0x01, 0x82,
+    0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82,
+    0x02, 0x82, 0x01, 0x88, 0x02, 0x87, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x0B, 0x30, 0x82, 0x00,
+    0x82, 0x00, 0x86, 0x00, 0x84, 0x02, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04,
+    0x82, 0x23, 0x3D, 0x85, 0x02, 0x86, 0x02, 0x81, 0x07, 0x83, 0x05, 0x86, 0x05, 0x84, 0x06, 0x82,
+    0x01, 0x87, 0x01, 0x86, 0x29, 0x20, 0x83, 0x03, 0x83, 0x02, 0x86, 0x00, 0x86, 0x01, 0x83, 0x03,
+    0x83, 0x03, 0x83, 0x03, 0x83, 0x04, 0x82, 0x04, 0x84, 0x03, 0x83, 0x20, 0x42, 0x82, 0x02, 0x82,
+    0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82,
+    0x01, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x87, 0x02, 0x87, 0x2C, 0x3C, 0x81, 0x03,
+    0x82, 0x00, 0x81, 0x03, 0x82, 0x00, 0x82, 0x02, 0x81, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82, 0x00,
+    0x82, 0x02, 0x85, 0x04, 0x84, 0x04, 0x83, 0x05, 0x83, 0x2A, 0x5A, 0x81, 0x02, 0x82, 0x02, 0x81,
+    0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x00, 0x83,
+    0x01, 0x81, 0x03, 0x81, 0x00, 0x81, 0x00, 0x84, 0x03, 0x84, 0x00, 0x84, 0x03, 0x84, 0x00, 0x84,
+    0x03, 0x83, 0x01, 0x83, 0x05, 0x82, 0x02, 0x82, 0x3E, 0x3C, 0x81, 0x03, 0x82, 0x00, 0x82, 0x01,
+    0x82, 0x02, 0x85, 0x04, 0x84, 0x04, 0x83, 0x05, 0x84, 0x03, 0x85, 0x02, 0x82, 0x01, 0x82, 0x01,
+    0x82, 0x02, 0x82, 0x27, 0x3B, 0x82, 0x03, 0x82, 0x00, 0x82, 0x02, 0x82, 0x00, 0x82, 0x02, 0x81,
+    0x02, 0x81, 0x01, 0x82, 0x02, 0x82, 0x00, 0x82, 0x02, 0x85, 0x04, 0x84, 0x04, 0x83, 0x06, 0x82,
+    0x06, 0x82, 0x04, 0x83, 0x04, 0x84, 0x05, 0x81, 0x05, 0x36, 0x86, 0x01, 0x87, 0x04, 0x82, 0x04,
+    0x82, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x05, 0x87, 0x00, 0x87, 0x23, 0x25, 0x84, 0x05, 0x83,
+    0x05, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x05, 0x84, 0x05, 0x83, 0x08, 0x82, 0x07, 0x82,
+    0x07, 0x82, 0x07, 0x82, 0x07, 0x83, 0x07, 0x84, 0x06, 0x82, 0x0C, 0x13, 0x81, 0x03, 0x81, 0x03,
+    0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03,
+    0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x01, 0x22, 0x83, 0x06, 0x84,
+    0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x08, 0x83, 0x06, 0x84, 0x04, 0x83, 0x06, 0x82,
+    0x07, 0x82, 0x07, 0x82, 0x07, 0x82, 0x05, 0x84, 0x05, 0x82, 0x10, 0x6B, 0x80, 0x09, 0x89, 0x02,
+    0x81, 0x00, 0x85, 0x69, 0x19, 0x83, 0x03, 0x80, 0x01, 0x80, 0x02, 0x81, 0x01, 0x81, 0x02, 0x80,
+    0x01, 0x80, 0x03, 0x83, 0x59, 0x48, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02,
+    0x82, 0x02, 0x89, 0x01, 0x89, 0x01, 0x82, 0x08, 0x82, 0x08, 0x82, 0x13, 0x27, 0x83, 0x07, 0x83,
+    0x07, 0x84, 0x05, 0x85, 0x05, 0x82, 0x00, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82,
+    0x03, 0x82, 0x02, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x01, 0x96, 0x2F, 0x2D,
+    0x84, 0x07, 0x87, 0x04, 0x83, 0x01, 0x83, 0x02, 0x83, 0x03, 0x82, 0x02, 0x82, 0x04, 0x83, 0x01,
+    0x82, 0x05, 0x82, 0x01, 0x82, 0x05, 0x82, 0x01, 0x82, 0x04, 0x83, 0x01, 0x83, 0x03, 0x82, 0x03,
+    0x83, 0x01, 0x82, 0x02, 0x85, 0x01, 0x84, 0x00, 0x85, 0x01, 0x84, 0x38, 0x7F, 0x40, 0x82, 0x01,
+    0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x40,
+};
+
+static const RleGlyph fontUi16Glyphs[] PROGMEM = {
+    { 0x0020,     0,  6 },
+    { 0x0021,     1,  7 },
+    { 0x0022,    24,  8 },
+    { 0x0023,    45, 13 },
+    { 0x0024,    84, 11 },
+    { 0x0025,   119, 16 },
+    { 0x0026,   184, 14 },
+    { 0x0027,   219,  5 },
+    { 0x0028,   230,  7 },
+    { 0x0029,   259,  7 },
+    { 0x002A,   288,  8 },
+    { 0x002B,   307, 13 },
+    { 0x002C,   328,  6 },
+    { 0x002D,   339,  7 },
+    { 0x002E,   346,  6 },
+    { 0x002F,   353,  6 },
+    { 0x0030,   382, 11 },
+    { 0x0031,   423, 11 },
+    { 0x0032,   448, 11 },
+    { 0x0033,   475, 11 },
+    { 0x0034,   504, 11 },
+    { 0x0035,   539, 11 },
+    { 0x0036,   568, 11 },
+    { 0x0037,   603, 11 },
+    { 0x0038,   628, 11 },
+    { 0x0039,   665, 11 },
+    { 0x003A,   698,  6 },
+    { 0x003B,   711,  6 },
+    { 0x003C,   728, 13 },
+    { 0x003D,   745, 13 },
+    { 0x003E,   754, 13 },
+    { 0x003F,   771,  9 },
+    { 0x0040,   796, 16 },
+    { 0x0041,   867, 12 },
+    { 0x0042,   902, 12 },
+    { 0x0043,   937, 12 },
+    { 0x0044,   966, 13 },
+    { 0x0045,  1005, 11 },
+    { 0x0046,  1030, 11 },
+    { 0x0047,  1055, 13 },
+    { 0x0048,  1092, 13 },
+    { 0x0049,  1137,  6 },
+    { 0x004A,  1162,  6 },
+    { 0x004B,  1193, 12 },
+    { 0x004C,  1234, 10 },
+    { 0x004D,  1259, 16 },
+    { 0x004E,  1316, 13 },
+    { 0x004F,  1369, 14 },
+    { 0x0050,  1410, 12 },
+    { 0x0051,  1441, 14 },
+    { 0x0052,  1486, 12 },
+    { 0x0053,  1523, 12 },
+    { 0x0054,  1552, 11 },
+    { 0x0055,  1573, 13 },
+    { 0x0056,  1618, 12 },
+    { 0x0057,  1657, 18 },
+    { 0x0058,  1728, 12 },
+    { 0x0059,  1767, 12 },
+    { 0x005A,  1800, 12 },
+    { 0x005B,  1825,  7 },
+    { 0x005C,  1854,  6 },
+    { 0x005D,  1883,  7 },
+    { 0x005E,  1912, 13 },
+    { 0x005F,  1928,  8 },
+    { 0x0060,  1931,  8 },
+    { 0x0061,  1938, 11 },
+    { 0x0062,  1963, 11 },
+    { 0x0063,  2002,  9 },
+    { 0x0064,  2021, 11 },
+    { 0x0065,  2058, 11 },
+    { 0x0066,  2081,  7 },
+    { 0x0067,  2104, 11 },
+    { 0x0068,  2145, 11 },
+    { 0x0069,  2186,  5 },
+    { 0x006A,  2209,  5 },
+    { 0x006B,  2240, 11 },
+    { 0x006C,  2277,  5 },
+    { 0x006D,  2302, 17 },
+    { 0x006E,  2353, 11 },
+    { 0x006F,  2388, 11 },
+    { 0x0070,  2417, 11 },
+    { 0x0071,  2456, 11 },
+    { 0x0072,  2493,  8 },
+    { 0x0073,  2514, 10 },
+    { 0x0074,  2533,  8 },
+    { 0x0075,  2556, 11 },
+    { 0x0076,  2589, 10 },
+    { 0x0077,  2618, 15 },
+    { 0x0078,  2665, 10 },
+    { 0x0079,  2692, 10 },
+    { 0x007A,  2729,  9 },
+    { 0x007B,  2748, 11 },
+    { 0x007C,  2779,  6 },
+    { 0x007D,  2812, 11 },
+    { 0x007E,  2843, 13 },
+    { 0x00B0,  2852,  8 },
+    { 0x00B5,  2869, 12 },
+    { 0x0394,  2908, 12 },
+    { 0x03A9,  2943, 14 },
+    { 0x2026,  2988, 16 },
+};
+
+const RleFont fontUi16 = {
+    fontUi16Runs, fontUi16Glyphs, 100, 19, 15
+};
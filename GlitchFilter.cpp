@@ -0,0 +1,36 @@
+// GlitchFilter.cpp
+
+#include "GlitchFilter.h"
+
+void GlitchFilter16::reset(uint16_t levels) {
+    out  = levels;
+    pend = 0;
+    for (uint8_t i = 0; i < 4; ++i) cnt[i] = 0;
+}
+
+void GlitchFilter16::setQualification(uint16_t pins, uint8_t ticks) {
+    if (ticks > MAX_TICKS) ticks = MAX_TICKS;
+    for (uint8_t i = 0; i < 4; ++i)
+        thr[i] = (ticks >> i & 1) ? (thr[i] | pins) : (thr[i] & ~pins);
+}
+
+uint16_t GlitchFilter16::update(uint16_t raw, bool tick) {
+    out &= raw;                                    // trips: immediate
+    pend = raw & ~out;
+
+    uint16_t carry = tick ? pend : 0;              // +1 on pending pins
+    uint16_t diff  = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+        const uint16_t c = cnt[i];
+        cnt[i] = (c ^ carry) & pend;               // others restart at 0
+        carry &= c;
+        diff |= cnt[i] ^ thr[i];
+    }
+    const uint16_t none = ~(thr[0] | thr[1] | thr[2] | thr[3]);
+    const uint16_t done = pend & (~diff | none);   // count == threshold
+
+    out  |= done;
+    pend &= ~done;
+    for (uint8_t i = 0; i < 4; ++i) cnt[i] &= pend;
+    return out;
+}
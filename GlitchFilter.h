@@ -0,0 +1,36 @@
+// GlitchFilter.h
+
+#ifndef GLITCH_FILTER_H
+#define GLITCH_FILTER_H
+
+#include <Arduino.h>
+
+// Asymmetric debounce for 16 active-LOW inputs at once.  A falling input
+// (a trip) is passed through on the sample that sees it; a rising input
+// is only released after it has read high on `ticks` consecutive counted
+// samples.  The per-pin counters and thresholds are stored as vertical
+// bit-planes, so one update is a dozen word operations whatever the
+// number of channels.
+class GlitchFilter16 {
+public:
+    static const uint8_t MAX_TICKS = 15;           // 4 counter planes
+
+    void reset(uint16_t levels);
+    // Release qualification for the pins in `pins`, 0 = none
+    void setQualification(uint16_t pins, uint8_t ticks);
+
+    // One sample.  Only `tick` samples advance the release counters, so
+    // extra reads between ticks cannot shorten the qualification.
+    uint16_t update(uint16_t raw, bool tick);
+
+    uint16_t levels()  const { return out; }
+    uint16_t pending() const { return pend; }     // high, not yet released
+
+private:
+    uint16_t out  = 0xFFFF;
+    uint16_t pend = 0;
+    uint16_t cnt[4] = { 0, 0, 0, 0 };              // counter bit-planes
+    uint16_t thr[4] = { 0, 0, 0, 0 };              // threshold bit-planes
+};
+
+#endif
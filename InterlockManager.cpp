@@ -1,145 +1,211 @@
 #include "InterlockManager.h"
-#include <Wire.h>
-#include "MenuState.h" // for color constants
+#include "TimerService.h"
+#include "GlitchFilter.h"
 
-// ───── TCA9555 Register Definitions ─────
-#define TCA_ADDR        0x20
+// ───── Channel table ─────
+constexpr InterlockItem interlocks[INTERLOCK_COUNT] = {
+  {"ΔPhase",    0, 0, true},
+  {"Overduty",  0, 1, true},
+  {"ΔMag",      0, 2, true},
+  {"Overpower", 0, 3, true},
+  {"User",      0, 4, true},
+  {"PSS",       0, 5, true},
+  {"External",  0, 6, true},
+  {"Global",    1, 2, true},
+  {"Reset",     0, 7, false}     // reset pulse output, not simulated
+};
+
+// pins of channels [n, INTERLOCK_COUNT), all or only the simulatable ones
+static constexpr uint16_t channelMask(bool simOnly, uint8_t n = 0) {
+  return n >= INTERLOCK_COUNT ? 0
+       : ((!simOnly || interlocks[n].allowSim) ? interlocks[n].mask() : 0)
+         | channelMask(simOnly, n + 1);
+}
+static_assert(channelMask(false) == INTERLOCK_PINS, "channel table does not match the board");
+static_assert(channelMask(true)  == SIM_PINS,       "channel table does not match SIM_PINS");
 
-#define REG_INPUT0      0x00
-#define REG_INPUT1      0x01
-#define REG_OUTPUT0     0x02
-#define REG_OUTPUT1     0x03
-#define REG_POLARITY0   0x04
-#define REG_POLARITY1   0x05
-#define REG_CONFIG0     0x06
-#define REG_CONFIG1     0x07
+// ───── TCA9555 at 0x20, registers shadowed ─────
+Tca9555 tca(0x20);
+
+// ───── Change detection on the open-drain INT line ─────
+#define TCA_INT_PIN     6          // PA20 / EXTINT4, external pull-up
+#define MAX_LISTENERS   6
+
+static volatile bool     intPending = false;
+static volatile uint32_t intUs      = 0;
+static uint16_t          inputs     = 0xFFFF;   // last filtered levels
+static bool              baseline   = false;    // set by initInterlocks()
+
+// ───── Glitch filter: trips pass at once, releases are qualified ─────
+#define FILTER_TICK_US      1000   // one counted sample per ms
+#define DEFAULT_RELEASE_MS  5
+
+static GlitchFilter16 filter;
+static uint32_t       lastTickUs = 0;
+
+static InterlockListener listeners[MAX_LISTENERS];
+static uint8_t           listenerCount = 0;
+
+static void onTcaInt() {
+  if (!intPending) {               // first edge of a burst sets the time
+    intUs      = micros();
+    intPending = true;
+  }
+}
+
+// Every input read goes through here: reading the port clears INT on the
+// chip, so whoever reads first has to publish the change.  Listeners see
+// filtered levels only.
+static uint16_t sampleInputs() {
+  if (!baseline) return tca.readInputs();   // no events before the baseline
+  uint32_t us = micros();
+  noInterrupts();
+  if (intPending) { us = intUs; intPending = false; }
+  interrupts();
+
+  const uint16_t raw  = tca.readInputs();
+  const uint32_t t    = micros();
+  const bool     tick = t - lastTickUs >= FILTER_TICK_US;
+  if (tick) lastTickUs = t;
+  const uint16_t now = filter.update(raw, tick);
+  if (now != inputs) {
+    const InterlockEvent ev = { us, inputs, now };
+    inputs = now;                  // before dispatch: listeners may read again
+    for (uint8_t i = 0; i < listenerCount; ++i) listeners[i](ev);
+  }
+  return now;
+}
 
-// ───── Internal I2C Helpers ─────
-void tcaWrite(uint8_t reg, uint8_t val) {
-  Wire.beginTransmission(TCA_ADDR);
-  Wire.write(reg);
-  Wire.write(val);
-  Wire.endTransmission();
+bool addInterlockListener(InterlockListener fn) {
+  for (uint8_t i = 0; i < listenerCount; ++i)
+    if (listeners[i] == fn) return true;       // re-init: already registered
+  if (listenerCount >= MAX_LISTENERS) return false;
+  listeners[listenerCount++] = fn;
+  return true;
 }
 
-uint8_t tcaRead(uint8_t reg) {
-  Wire.beginTransmission(TCA_ADDR);
-  Wire.write(reg);
-  Wire.endTransmission(false);
-  Wire.requestFrom(TCA_ADDR, (uint8_t)1);
-  return Wire.read();
+void serviceInterlocks() {
+  // the level check also catches an INT that was low before attach;
+  // pending releases need a sample every tick even without an edge
+  const bool releasing = filter.pending() &&
+                         micros() - lastTickUs >= FILTER_TICK_US;
+  if (!intPending && !releasing && digitalRead(TCA_INT_PIN) == HIGH) return;
+  sampleInputs();
 }
 
-// ───── Port I/O Controls ─────
-void tcaDir(uint8_t port, uint8_t bit, bool input) {
-  uint8_t cfg = tcaRead(REG_CONFIG0 + port);
-  if (input) cfg |= (1 << bit);
-  else       cfg &= ~(1 << bit);
-  tcaWrite(REG_CONFIG0 + port, cfg);
+void setReleaseQualification(uint8_t idx, uint8_t ms) {
+  if (idx >= INTERLOCK_COUNT) return;
+  const uint32_t ticks = (uint32_t)ms * 1000 / FILTER_TICK_US;
+  filter.setQualification(interlocks[idx].mask(),
+                          ticks > GlitchFilter16::MAX_TICKS ? GlitchFilter16::MAX_TICKS : ticks);
 }
 
-void tcaOut(uint8_t port, uint8_t bit, bool high) {
-  uint8_t out = tcaRead(REG_OUTPUT0 + port);
-  if (high) out |= (1 << bit);
-  else      out &= ~(1 << bit);
-  tcaWrite(REG_OUTPUT0 + port, out);
+uint16_t interlockInputs() {
+  return inputs;
 }
 
 // ───── Public API ─────
-InterlockItem interlocks[9] = {
-  {"ΔPhase",    0, 0, true},
-  {"Overduty",  0, 1, true},
-  {"ΔMag",      0, 2, true},
-  {"Overpower", 0, 3, true},
-  {"User",      0, 4, true},
-  {"PSS",       0, 5, true},
-  {"External",  0, 6, true},
-  {"Global",    1, 2, true},
-  {"Reset",     0, 7, false}
-};
 
 void initInterlocks() {
-  tcaWrite(REG_CONFIG0, 0xFF);     // all inputs
-  tcaWrite(REG_CONFIG1, 0xFF);
-  tcaWrite(REG_POLARITY0, 0x00);   // normal polarity
-  tcaWrite(REG_POLARITY1, 0x00);
+  tca.begin();                     // pick up the chip's registers
+  tca.setConfig(0, 0xFF);          // all inputs
+  tca.setConfig(1, 0xFF);
+  tca.setPolarity(0, 0x00);        // normal polarity
+  tca.setPolarity(1, 0x00);
+
+  for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i)
+    if (interlocks[i].allowSim) setReleaseQualification(i, DEFAULT_RELEASE_MS);
+  inputs = tca.readInputs();       // baseline, also releases INT
+  filter.reset(inputs);
+  baseline = true;
+  pinMode(TCA_INT_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(TCA_INT_PIN), onTcaInt, FALLING);
 }
 
-bool readInterlock(uint8_t port, uint8_t bit) {
-  uint8_t reg = (port == 0) ? REG_INPUT0 : REG_INPUT1;
-  return ((tcaRead(reg) >> bit) & 1) == 0;  // Active LOW = ON
+TcaPorts readInterlockPorts() {
+  return tca.snapshot(sampleInputs());
 }
 
 bool isSimulated(uint8_t port, uint8_t bit) {
-  uint8_t cfg = tcaRead(REG_CONFIG0 + port);
-  return ((cfg >> bit) & 1) == 0;  // Output = simulated
+  return ((tca.config(port) >> bit) & 1) == 0;  // Output = simulated
 }
 
-void setSimulated(uint8_t port, uint8_t bit, bool state) {
-  tcaDir(port, bit, false);
-  tcaOut(port, bit, !state);  // false = LOW = ON
-}
+// ───── Reset pulse: drive high now, release from a timer ─────
+#define RESET_PULSE_MS  500
+
+static TimerId resetTimer = TIMER_NONE;
 
-void toggleSimulated(uint8_t port, uint8_t bit) {
-  uint8_t out = tcaRead(REG_OUTPUT0 + port);
-  setSimulated(port, bit, ((out >> bit) & 1));
+static void endResetPulse() {
+  tca.setInput(0, 7, true);    // Set P7 back to INPUT (Hi-Z)
+  tca.setInput(1, 6, true);    // Set P14 back to INPUT
+  resetTimer = TIMER_NONE;
 }
 
-void sendResetPulse() {
+bool sendResetPulse() {
   // P7 = port 0, bit 7
   // P14 = port 1, bit 6
+  if (resetTimer != TIMER_NONE) return false;   // one already running
 
-  tcaDir(0, 7, false);   // Set P7 as OUTPUT
-  tcaOut(0, 7, true);    // Set P7 HIGH
-  tcaDir(1, 6, false);   // Set P14 as OUTPUT
-  tcaOut(1, 6, true);    // Set P14 HIGH
-  delay(500);            // Hold for 500ms
-  tcaDir(0, 7, true);    // Set P7 back to INPUT (Hi-Z)
-  tcaDir(1, 6, true);    // Set P14 back to INPUT
+  tca.setInput(0, 7, false);   // Set P7 as OUTPUT
+  tca.setLevel(0, 7, true);    // Set P7 HIGH
+  tca.setInput(1, 6, false);   // Set P14 as OUTPUT
+  tca.setLevel(1, 6, true);    // Set P14 HIGH
+
+  resetTimer = timerAfter(RESET_PULSE_MS, endResetPulse);
+  if (resetTimer == TIMER_NONE) {  // no free slot: old blocking path
+    delay(RESET_PULSE_MS);
+    endResetPulse();
+  }
+  return true;
+}
+
+bool resetPulseActive() {
+  return resetTimer != TIMER_NONE;
 }
 
 void applyEditStateToItem(uint8_t itemIndex, uint8_t state) {
-  if (itemIndex >= 9) return;
+  if (itemIndex >= INTERLOCK_COUNT) return;
   auto& it = interlocks[itemIndex];
   if (!it.allowSim) return;
 
   switch (state) {
     case 0:  // Input
-      tcaDir(it.port, it.bit, true);
+      tca.setInput(it.port, it.bit, true);
       break;
     case 1:  // Output LOW (Sim ON)
-      tcaDir(it.port, it.bit, false);
-      tcaOut(it.port, it.bit, false);
+      tca.setInput(it.port, it.bit, false);
+      tca.setLevel(it.port, it.bit, false);
       break;
     case 2:  // Output HIGH (Sim OFF)
-      tcaDir(it.port, it.bit, false);
-      tcaOut(it.port, it.bit, true);
+      tca.setInput(it.port, it.bit, false);
+      tca.setLevel(it.port, it.bit, true);
       break;
   }
   //if (state == 0)       tcaDir(it.port, it.bit, true);   // back to input
 //else                  /* keep as output */;
 }
 
-uint8_t readOutputRegister(uint8_t port) {
-  return tcaRead(REG_OUTPUT0 + port);
-}
+void applyEditStates(const uint8_t states[INTERLOCK_COUNT]) {
+  uint16_t driven = 0, high = 0;            // over SIM_PINS only
+  for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i) {
+    const uint16_t m = interlocks[i].mask();
+    if (!(m & SIM_PINS) || states[i] == 0 || states[i] > 2) continue;
+    driven |= m;
+    if (states[i] == 2) high |= m;
+  }
 
-uint16_t getStatusColor(uint8_t idx)
-{
-  if (idx >= 9) return COLOR_GRAY;
+  for (uint8_t port = 0; port < 2; ++port) {
+    const uint8_t sim = portByte(SIM_PINS, port);
+    const uint8_t drv = portByte(driven, port);
+    // latch first, so a pin that turns into an output drives the right level
+    tca.setOutput(port, (tca.output(port) & ~drv) | portByte(high, port));
+    tca.setConfig(port, (tca.config(port) & ~sim) | (sim & ~drv));
+  }
+}
 
+uint8_t editStateOfItem(uint8_t idx) {
+  if (idx >= INTERLOCK_COUNT) return 0;
   const auto& it = interlocks[idx];
-  bool sim       = isSimulated(it.port,it.bit);
-
-  if (sim)                       // simulated → yellow ring
-  {
-      bool outHigh = (readOutputRegister(it.port)>>it.bit)&1;
-      return outHigh ? (COLOR_GREEN|COLOR_YELLOW)
-                     : (COLOR_RED  |COLOR_YELLOW);
-  }
-  else                           // real input (active LOW)
-  {
-      bool active = readInterlock(it.port,it.bit);  // LOW→true
-      return active ? COLOR_RED : COLOR_GREEN;      // ← fixed
-  }
+  if (!isSimulated(it.port, it.bit)) return 0;
+  return ((tca.output(it.port) >> it.bit) & 1) ? 2 : 1;
 }
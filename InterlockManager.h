@@ -3,23 +3,56 @@
 
 #include <Arduino.h>
 #include "MenuState.h"
+#include "Tca9555.h"
 
 struct InterlockItem {
   const char* label;
   uint8_t port, bit;
   bool allowSim;
+
+  constexpr uint16_t mask() const { return TcaPorts::mask(port, bit); }
+};
+
+// ───── Channel table, fixed at compile time (InterlockManager.cpp) ─────
+#define INTERLOCK_COUNT  9
+
+extern const InterlockItem interlocks[INTERLOCK_COUNT];
+
+constexpr uint8_t portByte(uint16_t m, uint8_t port) { return (m >> (port * 8)) & 0xFF; }
+
+// pins of all channels, and of the simulatable ones (all but the Reset
+// output, P07); InterlockManager.cpp checks both against the table
+constexpr uint16_t INTERLOCK_PINS = 0x04FF;
+constexpr uint16_t SIM_PINS       = INTERLOCK_PINS & ~TcaPorts::mask(0, 7);
+
+// P10, the Global interlock: low = tripped, watched by the auto-reset
+constexpr uint16_t GLOBAL_PIN = TcaPorts::mask(1, 2);
+static_assert(SIM_PINS & GLOBAL_PIN, "Global is not in the channel table");
+
+/* input-change event, both ports (port 1 in the high byte) */
+struct InterlockEvent {
+  uint32_t us;          // micros() at the INT edge
+  uint16_t before;      // input levels before / after the change
+  uint16_t after;
 };
+typedef void (*InterlockListener)(const InterlockEvent& ev);
 
-extern InterlockItem interlocks[9];
+extern Tca9555 tca;
 
 void initInterlocks();
-bool readInterlock(uint8_t port,uint8_t bit);
+TcaPorts readInterlockPorts();   // one input burst + shadows, share per refresh
+void serviceInterlocks();        // critical 1 ms task: burst read after an INT edge
+uint16_t interlockInputs();      // last filtered levels, no bus traffic
+// releases (LOW→HIGH) must hold this long before they count; trips never wait
+void setReleaseQualification(uint8_t idx, uint8_t ms);
+bool addInterlockListener(InterlockListener fn);   // false when the table is full; once per fn
 bool isSimulated(uint8_t port,uint8_t bit);
-void setSimulated(uint8_t port,uint8_t bit,bool state);
-void toggleSimulated(uint8_t port,uint8_t bit);
-void sendResetPulse();
+bool sendResetPulse();           // false while a pulse is still running
+bool resetPulseActive();
 void applyEditStateToItem(uint8_t idx,uint8_t state);
-uint8_t readOutputRegister(uint8_t port);
-uint16_t getStatusColor(uint8_t idx);
+// edit states (0 input, 1 sim ON, 2 sim OFF) for all channels at once:
+// at most one output and one config write per port
+void applyEditStates(const uint8_t states[INTERLOCK_COUNT]);
+uint8_t editStateOfItem(uint8_t idx);     // from the shadows, no bus
 
 #endif
@@ -0,0 +1,39 @@
+#ifndef LED_SPRITES_H
+#define LED_SPRITES_H
+
+#include <Arduino.h>
+#include "ST7365P_Display.h"
+
+/* ────────────────────────────────────────────
+   Status LED: 21×21 sprite, two concentric
+   discs (r = 10 ring, r = 8 fill) as compile-
+   time span tables.  Colours pick the state:
+     plain  → ring colour = background
+     outline→ ring colour = yellow            */
+
+/* widest dx with dx² + dy² ≤ r² (C++11: single-return recursion) */
+constexpr uint8_t ledHalf(int r, int dy, int dx = 0)
+{
+    return (dx + 1) * (dx + 1) + dy * dy <= r * r ? ledHalf(r, dy, dx + 1) : dx;
+}
+/* span-table entry: half-width + 1, 0 = row not covered */
+constexpr uint8_t ledSpan(int r, int dy)
+{
+    return dy * dy > r * r ? 0 : ledHalf(r, dy) + 1;
+}
+
+#define LED_ROW(dy)  ledSpan(10, dy), ledSpan(8, dy)
+
+static constexpr uint8_t LED_SPANS[21 * 2] = {
+    LED_ROW(-10), LED_ROW(-9), LED_ROW(-8), LED_ROW(-7), LED_ROW(-6),
+    LED_ROW( -5), LED_ROW(-4), LED_ROW(-3), LED_ROW(-2), LED_ROW(-1),
+    LED_ROW(  0),
+    LED_ROW(  1), LED_ROW( 2), LED_ROW( 3), LED_ROW( 4), LED_ROW( 5),
+    LED_ROW(  6), LED_ROW( 7), LED_ROW( 8), LED_ROW( 9), LED_ROW(10)
+};
+
+#undef LED_ROW
+
+static constexpr SpanSprite LED_SPRITE = { 21, 2, LED_SPANS };
+
+#endif
@@ -20,6 +20,7 @@ enum TabID {
   TAB_OVERVIEW = 0,
   TAB_SETTINGS,
   TAB_AUXILIARY,
+  TAB_LOG,              // event console, no selectable rows
   TAB_COUNT
 };
 
@@ -55,6 +56,7 @@ inline uint8_t itemCountForTab(TabID tab) {
     case TAB_OVERVIEW:    return 9;
     case TAB_SETTINGS:    return 8;
     case TAB_AUXILIARY:   return 5; //  ←  use the symbol
+    case TAB_LOG:         return 0;
     default:              return 0;
   }
 }
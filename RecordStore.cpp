@@ -0,0 +1,82 @@
+// RecordStore.cpp
+
+#include "RecordStore.h"
+#include "EepromManager.h"
+
+uint16_t crc16Ccitt(const void* data, uint16_t len, uint16_t crc) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (len--) {
+        crc ^= (uint16_t)*p++ << 8;
+        for (uint8_t b = 0; b < 8; ++b)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+bool RecordStore::readSlot(uint16_t slot, uint8_t* buf, uint32_t* seqOut) {
+    if (!eepromReadBlock(slotAddr(slot), buf, slotSize)) return false;
+    if (buf[0] != MAGIC || buf[1] != version) return false;
+
+    const uint16_t crc = buf[slotSize - 2] | (uint16_t)buf[slotSize - 1] << 8;
+    if (crc16Ccitt(buf, slotSize - 2) != crc) return false;
+
+    *seqOut = buf[2] | (uint32_t)buf[3] << 8 | (uint32_t)buf[4] << 16 | (uint32_t)buf[5] << 24;
+    return true;
+}
+
+bool RecordStore::begin() {
+    uint8_t  buf[MAX_SLOT];
+    uint32_t s0, s;
+    reset();
+
+    if (!readSlot(0, buf, &s0)) {
+        // Slot 0 blank, or torn right after the region wrapped: then the
+        // last slot is the newest record
+        if (readSlot(slots - 1, buf, &s)) { head = slots - 1; seq = s; }
+        return !empty();
+    }
+
+    // Largest i with seq(i) == seq(0) + i; true for i = 0
+    uint16_t lo = 0, hi = slots - 1;
+    while (lo < hi) {
+        const uint16_t mid = lo + (hi - lo + 1) / 2;
+        if (readSlot(mid, buf, &s) && s == s0 + mid) lo = mid;
+        else                                           hi = mid - 1;
+    }
+    head = lo;
+    seq  = s0 + lo;
+    return true;
+}
+
+bool RecordStore::load(void* payload, uint8_t len) {
+    uint8_t  buf[MAX_SLOT];
+    uint32_t s;
+    if (empty() || !readSlot(head, buf, &s)) return false;
+    if (len > payloadSize()) len = payloadSize();
+    memcpy(payload, buf + 6, len);
+    return true;
+}
+
+void RecordStore::append(const void* payload, uint8_t len) {
+    uint8_t buf[MAX_SLOT];
+    if (len > payloadSize()) len = payloadSize();
+
+    const uint16_t slot = empty() ? 0 : (head + 1) % slots;
+    const uint32_t next = seq + 1;
+
+    memset(buf, 0xFF, slotSize);
+    buf[0] = MAGIC;
+    buf[1] = version;
+    buf[2] = next;
+    buf[3] = next >> 8;
+    buf[4] = next >> 16;
+    buf[5] = next >> 24;
+    memcpy(buf + 6, payload, len);
+    const uint16_t crc = crc16Ccitt(buf, slotSize - 2);
+    buf[slotSize - 2] = crc;
+    buf[slotSize - 1] = crc >> 8;
+
+    eepromWriteBlock(slotAddr(slot), buf, slotSize);
+    head = slot;
+    seq  = next;
+}
@@ -0,0 +1,69 @@
+// RecordStore.h
+
+#ifndef RECORD_STORE_H
+#define RECORD_STORE_H
+
+#include <Arduino.h>
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), bitwise - no table
+uint16_t crc16Ccitt(const void* data, uint16_t len, uint16_t crc = 0xFFFF);
+
+// Log-structured record store over a reserved EEPROM region.  The region
+// is cut into fixed-size slots, each holding one complete record:
+//
+//   magic | version | seq (4, LSB first) | payload | crc16 over the rest
+//
+// A save never rewrites the current record; it appends the next sequence
+// number into the following slot (wrapping at the end of the region), so
+// a write torn by a power loss only damages the slot being written and
+// the previous record stays the newest valid one.  Saves rotate through
+// every slot, which spreads the wear over the whole region.
+//
+// Slots 0..head hold consecutive sequence numbers and the slots after the
+// head hold older (or blank) records, so begin() finds the head with a
+// binary search on "seq(i) == seq(0) + i": log2(slots) slot reads.
+class RecordStore {
+public:
+    static const uint8_t MAX_SLOT = 64;
+    static const uint8_t OVERHEAD = 8;              // magic, version, seq, crc
+
+    // base and slotSize should keep every slot inside one EEPROM page;
+    // slots are read into a MAX_SLOT stack buffer, larger sizes are clamped
+    RecordStore(uint32_t base, uint16_t slots, uint8_t slotSize, uint8_t version)
+        : base(base), slots(slots), slotSize(slotSize > MAX_SLOT ? MAX_SLOT : slotSize),
+          version(version) {}
+
+    // Locate the newest valid record; false if the region holds none
+    bool begin();
+    // Newest record's payload, up to len bytes; false if there is none
+    bool load(void* payload, uint8_t len);
+    // Write a new record after the head (one page write, not waited for)
+    void append(const void* payload, uint8_t len);
+    // The region has been erased: the next append starts at slot 0
+    void reset() { head = NONE; seq = 0; }
+    // Partly erased: the next append goes to slot 0 numbered above s, so
+    // records left in the higher slots can never continue its run
+    void restartAfter(uint32_t s) { head = NONE; seq = s; }
+
+    bool     empty()       const { return head == NONE; }
+    uint16_t headSlot()    const { return head; }
+    uint32_t sequence()    const { return seq; }
+    uint8_t  payloadSize() const { return slotSize - OVERHEAD; }
+
+private:
+    static const uint8_t  MAGIC = 0xC5;
+    static const uint16_t NONE  = 0xFFFF;
+
+    uint32_t slotAddr(uint16_t slot) const { return base + (uint32_t)slot * slotSize; }
+    // One sequential read; true if the slot holds a valid record
+    bool readSlot(uint16_t slot, uint8_t* buf, uint32_t* seqOut);
+
+    uint32_t base;
+    uint16_t slots;
+    uint8_t  slotSize;
+    uint8_t  version;
+    uint16_t head = NONE;
+    uint32_t seq  = 0;
+};
+
+#endif
@@ -0,0 +1,49 @@
+// RleFont.cpp
+
+#include "RleFont.h"
+
+uint16_t utf8Next(const char*& s) {
+    uint8_t c = (uint8_t)*s;
+    if (!c) return 0;
+    s++;
+    if (c < 0x80) return c;
+
+    uint8_t  extra;
+    uint16_t cp;
+    if      ((c & 0xE0) == 0xC0) { extra = 1; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { extra = 2; cp = c & 0x0F; }
+    else {                                       // stray continuation / 4-byte
+        while ((*s & 0xC0) == 0x80) s++;
+        return '?';
+    }
+    while (extra--) {
+        uint8_t n = (uint8_t)*s;
+        if ((n & 0xC0) != 0x80) return '?';      // truncated: leave `s` on n
+        cp = (cp << 6) | (n & 0x3F);
+        s++;
+    }
+    return cp;
+}
+
+const RleGlyph* rleFindGlyph(const RleFont& font, uint16_t cp) {
+    // Binary search over the sorted glyph table
+    uint16_t lo = 0, hi = font.glyphCount;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        uint16_t c   = pgm_read_word(&font.glyphs[mid].codepoint);
+        if      (c < cp) lo = mid + 1;
+        else if (c > cp) hi = mid;
+        else             return &font.glyphs[mid];
+    }
+    return cp == '?' ? &font.glyphs[0] : rleFindGlyph(font, '?');
+}
+
+uint16_t rleTextWidth(const RleFont& font, const char* utf8, uint16_t maxBytes) {
+    const char* start = utf8;
+    uint16_t w = 0;
+    while (*utf8 && (uint16_t)(utf8 - start) < maxBytes) {
+        uint16_t cp = utf8Next(utf8);
+        w += pgm_read_byte(&rleFindGlyph(font, cp)->advance);
+    }
+    return w;
+}
@@ -0,0 +1,38 @@
+// RleFont.h
+
+#ifndef RLE_FONT_H
+#define RLE_FONT_H
+
+#include <Arduino.h>
+
+// Run-length encoded bitmap font (see tools/fontconv.py).
+// Each glyph is a full  advance × height  cell stored row-major as runs,
+// one byte per run: bit 7 = foreground, bits 6..0 = length - 1.
+struct RleGlyph {
+    uint16_t codepoint;     // Unicode BMP, table sorted ascending
+    uint16_t offset;        // first run byte in RleFont::runs
+    uint8_t  advance;       // cell width in pixels
+};
+
+struct RleFont {
+    const uint8_t*  runs;
+    const RleGlyph* glyphs;
+    uint16_t        glyphCount;
+    uint8_t         height;     // cell height in pixels
+    uint8_t         baseline;   // rows above the baseline
+};
+
+// Fonts generated into the sketch
+extern const RleFont fontUi16;   // DejaVu Sans Bold, 16 px
+
+// Next code point from a UTF-8 string (advances `s`).  Malformed or
+// non-BMP sequences come back as '?', end of string as 0.
+uint16_t utf8Next(const char*& s);
+
+// Glyph for a code point, or the '?' glyph if the font does not have it
+const RleGlyph* rleFindGlyph(const RleFont& font, uint16_t cp);
+
+// Width in pixels of a UTF-8 string (at most `maxBytes` bytes of it)
+uint16_t rleTextWidth(const RleFont& font, const char* utf8, uint16_t maxBytes = 0xFFFF);
+
+#endif
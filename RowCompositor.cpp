@@ -0,0 +1,93 @@
+// RowCompositor.cpp
+
+#include "RowCompositor.h"
+#include "ST7365P_Display.h"
+
+void RowCompositor::clear(uint8_t idx) {
+    idx &= 0x0F;
+    memset(pix, (idx << 4) | idx, sizeof(pix));
+}
+
+// Clipped horizontal span; whole bytes are written two pixels at a time
+inline void RowCompositor::hspan(int16_t x, int16_t y, int16_t w, uint8_t idx) {
+    if (y < 0 || y >= (int16_t)H) return;
+    if (x < 0) { w += x; x = 0; }
+    if (x + w > (int16_t)W) w = W - x;
+    if (w <= 0) return;
+
+    uint8_t* p = pix + (y * W + x) / 2;
+    if (x & 1) { *p = (*p & 0xF0) | idx; p++; x++; w--; }
+    uint8_t both = (idx << 4) | idx;
+    for (; w >= 2; w -= 2) *p++ = both;
+    if (w) *p = (*p & 0x0F) | (idx << 4);
+}
+
+void RowCompositor::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t idx) {
+    idx &= 0x0F;
+    for (int16_t j = 0; j < h; j++) hspan(x, y + j, w, idx);
+}
+
+void RowCompositor::drawSprite(int16_t x, int16_t y, const SpanSprite& sprite, uint8_t firstIdx) {
+    const uint8_t c = sprite.size / 2;
+    for (uint8_t row = 0; row < sprite.size; row++) {
+        const uint8_t* hw = sprite.spans + row * sprite.layers;
+        for (uint8_t l = 0; l < sprite.layers; l++)       // outer first
+            if (hw[l]) hspan(x + c - (hw[l] - 1), y + row, 2 * hw[l] - 1,
+                             (firstIdx + l) & 0x0F);
+    }
+}
+
+uint16_t RowCompositor::drawText(int16_t x, int16_t y, const char* utf8, const RleFont& font, uint8_t idx) {
+    idx &= 0x0F;
+    uint16_t width = 0;
+    while (*utf8) {
+        const RleGlyph* gl  = rleFindGlyph(font, utf8Next(utf8));
+        const uint8_t   adv = pgm_read_byte(&gl->advance);
+        const uint8_t*  run = font.runs + pgm_read_word(&gl->offset);
+
+        // Walk the cell's runs; foreground runs become (row-split) spans
+        uint16_t pos = 0, cell = (uint16_t)adv * font.height;
+        while (pos < cell) {
+            uint8_t r   = pgm_read_byte(run++);
+            uint8_t len = (r & 0x7F) + 1;
+            if (r & 0x80) {
+                uint16_t p = pos, left = len;
+                while (left) {
+                    uint8_t col = p % adv, row = p / adv;
+                    uint8_t n   = adv - col < left ? adv - col : left;
+                    hspan(x + width + col, y + row, n, idx);
+                    p += n; left -= n;
+                }
+            }
+            pos += len;
+        }
+        width += adv;
+    }
+    return width;
+}
+
+void RowCompositor::flush(ST7365P_Display& tft, uint16_t y, uint16_t x0, uint16_t w) {
+    if (x0 >= W) return;
+    if (x0 + w > W) w = W - x0;
+    if (!w) return;
+
+    // Expand through the palette, merging equal neighbours into runs
+    uint16_t runColor = palette[0];
+    uint32_t runLen   = 0;
+    tft.beginWindow(x0, y, w, H);
+    for (uint16_t j = 0; j < H; j++) {
+        const uint8_t* row = pix + j * (W / 2);
+        for (uint16_t i = x0; i < x0 + w; i++) {
+            uint8_t  b = row[i >> 1];
+            uint16_t c = palette[(i & 1) ? (b & 0x0F) : (b >> 4)];
+            if (c != runColor && runLen) {
+                tft.pushColor(runColor, runLen);
+                runLen = 0;
+            }
+            runColor = c;
+            runLen++;
+        }
+    }
+    if (runLen) tft.pushColor(runColor, runLen);
+    tft.endWindow();
+}
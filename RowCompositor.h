@@ -0,0 +1,41 @@
+// RowCompositor.h
+
+#ifndef ROW_COMPOSITOR_H
+#define ROW_COMPOSITOR_H
+
+#include <Arduino.h>
+#include "RleFont.h"
+
+class ST7365P_Display;
+struct SpanSprite;
+
+// One 480×24 menu row rendered off-screen at 4 bits per pixel (5.6 KB)
+// and sent to the panel in a single window, so a row update has no
+// overdraw, no flicker and a fixed cost.  Drawing calls take palette
+// indices; flush() expands them through the 16-entry palette.
+class RowCompositor {
+public:
+    static const uint16_t W = 480;
+    static const uint16_t H = 24;
+
+    void setPalette(uint8_t idx, uint16_t color) { palette[idx & 0x0F] = color; }
+
+    void clear(uint8_t idx);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t idx);
+    // Sprite layer l is drawn with palette index firstIdx + l; the sprite
+    // background is left untouched
+    void drawSprite(int16_t x, int16_t y, const SpanSprite& sprite, uint8_t firstIdx);
+    // Transparent UTF-8 text, returns its width
+    uint16_t drawText(int16_t x, int16_t y, const char* utf8, const RleFont& font, uint8_t idx);
+
+    // Stream columns [x0, x0+w) of the buffer to panel row `y`
+    void flush(ST7365P_Display& tft, uint16_t y, uint16_t x0 = 0, uint16_t w = W);
+
+private:
+    inline void hspan(int16_t x, int16_t y, int16_t w, uint8_t idx);
+
+    uint8_t  pix[W * H / 2];     // even x in the high nibble
+    uint16_t palette[16];
+};
+
+#endif
@@ -7,30 +7,92 @@
 #include "InterlockManager.h"
 #include "EepromManager.h"
 #include "AuxManager.h"
+#include "FaultRecorder.h"
+#include "TripStats.h"
+#include "TripLog.h"
+#include "TimerService.h"
+#include "Scheduler.h"
+
+/* ───── tasks (periods / budgets in µs) ───── */
+static void displayTask() {
+  refreshTripStatsRows();
+  auxRefresh();
+  if (menuState.screen == SCREEN_MENU &&
+      millis() - menuState.lastAction > IDLE_MS) {
+    showIdleScreen();
+  }
+}
+
+static void serialTask() {       // 's' = dump timing, 'r' = reset it, 'l' = trip log, 'f' = faults, 'x' = reboot
+  if (!Serial.available()) return;
+  switch (Serial.read()) {
+    case 's': dumpTaskStats(); dumpDisplayStats(); break;
+    case 'r': resetTaskStats(); resetDisplayStats(); break;
+    case 'l': dumpTripLog(20); break;
+    case 'f': dumpFaults(); break;
+    case 'x': eepromFlushAll(); NVIC_SystemReset(); break;   // nothing queued is lost
+  }
+}
+
+// I²C runs at the default 100 kHz: ~10 µs per bit, 90 µs per byte + ACK.
+// A TCA9555 input read (address + register, restart, address + 2 bytes)
+// is ~450 µs on the wire; a reset pulse is two register writes, ~540 µs.
+// A 32-byte EEPROM read or write is ~3.2 ms.
+//
+// Nothing preempts a task, so an INT edge waits for whatever runs when it
+// comes.  The EEPROM helpers yield to the critical tasks between bus
+// transactions (and between ACK polls) and UI paints yield between rows,
+// so an edge waits for at most one 32-byte EEPROM transfer (~3.3 ms) or
+// one row paint, then its own ~450 µs read.  's' shows the worst runs.
+struct TaskDef {
+  const char* name;
+  TaskFn      fn;
+  uint32_t    periodUs, budgetUs;
+  bool        critical;
+};
+
+static const TaskDef taskTable[] = {
+  // protection first: these also run from schedulerYield() in UI and EEPROM work
+  { "interlocks", serviceInterlocks,   1000,   600, true  },  // INT edge → one 2-byte read
+  { "autoreset",  auxTick,            10000,   700, true  },  // cached levels, pulse writes
+  { "timers",     serviceTimers,       1000,  5000, false },  // pulse release, UI effects
+  { "encoder",    pollEncoder,         1000, 20000, false },
+  { "buttons",    pollButtons,         5000, 20000, false },
+  { "leds",       refreshOverviewLeds, 20000, 5000, false },  // 1 burst, SPI only on change
+  { "display",    displayTask,        50000, 20000, false },
+  { "eeprom",     serviceSettings,    50000,  4000, false },  // write-behind settings, 1 slot
+  { "format",     serviceFormat,      10000,  4000, false },  // one 32-byte read or write
+  { "triplog",    serviceTripLog,     20000,  4000, false },  // ≤ 2 records, one write
+  { "serial",     serialTask,        100000,  5000, false },
+};
+static_assert(sizeof(taskTable) / sizeof(taskTable[0]) <= MAX_TASKS, "raise MAX_TASKS");
+
+static void startTasks() {
+  for (const TaskDef& t : taskTable)
+    taskAdd(t.name, t.fn, t.periodUs, t.budgetUs, t.critical);
+}
 
 void setup()
 {
   Serial.begin(115200);
   Wire.begin();
+  initFaultRecorder();           // listener must precede the display's
+  initTripStats();
+  initInterlocks();              // input baseline before anything samples
   initDisplay();                 // tft.begin(), clears the screen
   initButtons();
   initEncoder();
-  initInterlocks();
   initEeprom();
   loadOverviewSettings();        // may change simulated bits
+  loadAuxSettings();             // auto-reset enable and delay
+  initTripLog();                 // head search, BOOT record
   auxInit();                     // sets back-light etc.
   redrawAll();                   // ←  move DOWN here
+  consoleLog("Boot");
   bumpIdleTimer();               // start idle timer
+  startTasks();
 }
 
 void loop() {
-  pollButtons();
-  pollEncoder();
-  auxTick();
-
-delay(1);
-  if (menuState.screen == SCREEN_MENU &&
-      millis() - menuState.lastAction > IDLE_MS) {
-    showIdleScreen();
-  }
+  schedulerRun();
 }
@@ -2,32 +2,19 @@
 
 #include "ST7365P_Display.h"
 
-// Direct‐port writes for MKR Zero (SAMD21)
-#define WR_CS_LOW()   PORT->Group[PORTA].OUTCLR.reg = (1 << 22)
-#define WR_CS_HIGH()  PORT->Group[PORTA].OUTSET.reg = (1 << 22)
-#define WR_SCK_LOW()  PORT->Group[PORTA].OUTCLR.reg = (1 << 17)
-#define WR_SCK_HIGH() PORT->Group[PORTA].OUTSET.reg = (1 << 17)
-#define WR_SDA_LOW()  PORT->Group[PORTA].OUTCLR.reg = (1 << 16)
-#define WR_SDA_HIGH() PORT->Group[PORTA].OUTSET.reg = (1 << 16)
+// The 5x7 font table is static inside Adafruit_GFX.cpp.  Rather than link
+// a second copy, each glyph is drawn once into a 6x8 1-bit canvas by the
+// library itself (cp437 quirk included) and its columns read back.
+static GFXcanvas1 glyphCell(6, 8);
 
-static inline void pulseClock() {
-    WR_SCK_LOW();
-    WR_SCK_HIGH();
-}
-
-ST7365P_Display::ST7365P_Display()
+ST7365P_Display::ST7365P_Display(ST7365P_Transport& bus)
   : Adafruit_GFX(PANEL_W, PANEL_H)  // initialize base GFX with width & height
+  , bus(bus)
 {}
 
 void ST7365P_Display::begin() {
     pinMode(PIN_RST, OUTPUT);
-    pinMode(PIN_CS,  OUTPUT);
-    pinMode(PIN_SCK, OUTPUT);
-    pinMode(PIN_SDA, OUTPUT);
-
-    WR_CS_HIGH();
-    WR_SCK_HIGH();
-    WR_SDA_HIGH();
+    bus.begin();
 
     hwReset();
     initDisplay();
@@ -51,60 +38,156 @@ void ST7365P_Display::initDisplay() {
     sendCmd(0x20);                        // INVOFF
 }
 
-void ST7365P_Display::setColumn(uint16_t x0, uint16_t x1) {
-    sendCmd(0x2A);
-    sendData(x0 >> 8); sendData(x0 & 0xFF);
-    sendData(x1 >> 8); sendData(x1 & 0xFF);
+// CASET + RASET + RAMWR inside an already open CS frame
+void ST7365P_Display::setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    ST_STAT(windows, 1);
+    ST_STAT(commands, 3);
+    ST_STAT(dataBytes, 8);
+    y0 += YOFF;
+    y1 += YOFF;
+    bus.write9(0, 0x2A);
+    bus.write9(1, x0 >> 8); bus.write9(1, x0 & 0xFF);
+    bus.write9(1, x1 >> 8); bus.write9(1, x1 & 0xFF);
+    bus.write9(0, 0x2B);
+    bus.write9(1, y0 >> 8); bus.write9(1, y0 & 0xFF);
+    bus.write9(1, y1 >> 8); bus.write9(1, y1 & 0xFF);
+    bus.write9(0, 0x2C);
+}
+
+void ST7365P_Display::sendCmd(uint8_t cmd) {
+    ST_STAT(commands, 1);
+    bus.select();
+    bus.write9(0, cmd);
+    bus.deselect();
+}
+
+void ST7365P_Display::sendData(uint8_t data) {
+    ST_STAT(dataBytes, 1);
+    bus.select();
+    bus.write9(1, data);
+    bus.deselect();
+}
+
+// Command plus parameters in a single CS frame
+void ST7365P_Display::sendCmdArgs(uint8_t cmd, const uint8_t* args, uint8_t n) {
+    ST_STAT(commands, 1);
+    ST_STAT(dataBytes, n);
+    bus.select();
+    bus.write9(0, cmd);
+    while (n--) bus.write9(1, *args++);
+    bus.deselect();
+}
+
+// ───── Streaming pixel transactions ─────
+void ST7365P_Display::beginWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    bus.select();
+    setWindow(x, y, x + w - 1, y + h - 1);
 }
 
-void ST7365P_Display::setRow(uint16_t y0, uint16_t y1) {
-    sendCmd(0x2B);
-    sendData(y0 >> 8); sendData(y0 & 0xFF);
-    sendData(y1 >> 8); sendData(y1 & 0xFF);
+void ST7365P_Display::pushColor(uint16_t color, uint32_t count) {
+    ST_STAT(pixels, count);
+    ST_STAT(dataBytes, count * 2);
+    bus.fillWords(~color, count);
 }
 
-void ST7365P_Display::startRAM() {
-    sendCmd(0x2C);
+void ST7365P_Display::endWindow() {
+    bus.deselect();
 }
 
-void ST7365P_Display::sendSPI9(uint8_t dc, uint8_t val) {
-    WR_CS_LOW();
-    // 9th bit = D/C
-    if (dc) WR_SDA_HIGH();
-    else    WR_SDA_LOW();
-    pulseClock();
-    // 8 data bits
-    for (int8_t i = 7; i >= 0; i--) {
-        if (val & (1 << i)) WR_SDA_HIGH();
-        else                WR_SDA_LOW();
-        pulseClock();
+// ───── Span sprites ─────
+void ST7365P_Display::drawSprite(int16_t x, int16_t y, const SpanSprite& sprite, const uint16_t* colors) {
+    const uint8_t n = sprite.size, c = n / 2;
+    if (x < 0 || y < 0 || x + n > PANEL_W || y + n > PANEL_H) return;
+
+    uint16_t runColor = colors[0];
+    uint32_t runLen   = 0;
+    beginWindow(x, y, n, n);
+    for (uint8_t row = 0; row < n; row++) {
+        const uint8_t* hw = sprite.spans + row * sprite.layers;
+        for (uint8_t i = 0; i < n; i++) {
+            const uint8_t d = i > c ? i - c : c - i;
+            uint8_t idx = 0;
+            for (uint8_t l = 0; l < sprite.layers; l++)
+                if (d < hw[l]) idx = l + 1;
+            if (colors[idx] != runColor && runLen) {
+                pushColor(runColor, runLen);
+                runLen = 0;
+            }
+            runColor = colors[idx];
+            runLen++;
+        }
     }
-    WR_CS_HIGH();
+    pushColor(runColor, runLen);
+    endWindow();
 }
 
-void ST7365P_Display::sendCmd(uint8_t cmd) {
-    sendSPI9(0, cmd);
+// ───── Hardware scrolling ─────
+void ST7365P_Display::setScrollRegion(uint16_t top, uint16_t height) {
+    if (top >= PANEL_H) return;
+    if (top + height > PANEL_H) height = PANEL_H - top;
+    scrollTop    = top + YOFF;
+    scrollHeight = height;
+    const uint16_t bfa = RAM_H - scrollTop - height;
+    const uint8_t args[6] = { (uint8_t)(scrollTop >> 8), (uint8_t)scrollTop,
+                              (uint8_t)(height >> 8),    (uint8_t)height,
+                              (uint8_t)(bfa >> 8),       (uint8_t)bfa };
+    sendCmdArgs(0x33, args, sizeof(args));           // VSCRDEF
 }
 
-void ST7365P_Display::sendData(uint8_t data) {
-    sendSPI9(1, data);
+void ST7365P_Display::scrollTo(uint16_t line) {
+    if (!scrollHeight) return;
+    const uint16_t vsp = scrollTop + line % scrollHeight;
+    const uint8_t args[2] = { (uint8_t)(vsp >> 8), (uint8_t)vsp };
+    sendCmdArgs(0x37, args, sizeof(args));           // VSCRSADD
+}
+
+void ST7365P_Display::resetScroll() {
+    const uint8_t def[6] = { 0, 0, RAM_H >> 8, RAM_H & 0xFF, 0, 0 };
+    const uint8_t vsp[2] = { 0, 0 };
+    sendCmdArgs(0x33, def, sizeof(def));
+    sendCmdArgs(0x37, vsp, sizeof(vsp));
+    scrollTop    = 0;
+    scrollHeight = 0;
+}
+
+void ST7365P_Display::sleep() {
+    if (asleep) return;
+    sendCmd(0x28);                                   // DISPOFF
+    sendCmd(0x10);                                   // SLPIN
+    powerMs = millis();
+    asleep  = true;
+}
+
+void ST7365P_Display::sleepOut() {
+    if (!asleep) return;
+    sendCmd(0x11);                                   // SLPOUT
+    powerMs = millis();
+    asleep  = false;
+}
+
+void ST7365P_Display::displayOn() {
+    sendCmd(0x29);                                   // DISPON
+}
+
+uint32_t ST7365P_Display::powerDelayMs() const {
+    const uint32_t t = millis() - powerMs;
+    return t < 120 ? 120 - t : 0;
 }
 
 void ST7365P_Display::fillRectFast(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    // Fills w×h area with color (inverted internally if hardware needs it)
-    uint16_t inv = ~color;
-    setColumn(x, x + w - 1);
-    setRow(y + YOFF, y + YOFF + h - 1);
-    startRAM();
-    uint32_t total = (uint32_t)w * h;
-    while (total--) {
-        sendData(inv >> 8);
-        sendData(inv & 0xFF);
-    }
+    if (w == 0 || h == 0) return;
+    beginWindow(x, y, w, h);
+    pushColor(color, (uint32_t)w * h);
+    endWindow();
 }
 
 void ST7365P_Display::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-    // GFX override: just call your fast routine
+    // GFX override: clip to the panel, then the fast routine
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > PANEL_W) w = PANEL_W - x;
+    if (y + h > PANEL_H) h = PANEL_H - y;
+    if (w <= 0 || h <= 0) return;
     fillRectFast(x, y, w, h, color);
 }
 
@@ -115,12 +198,158 @@ void ST7365P_Display::fillScreen(uint16_t color) {
 // **THIS** is the one pure‐virtual Adafruit_GFX requires
 void ST7365P_Display::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if (x < 0 || x >= PANEL_W || y < 0 || y >= PANEL_H) return;
-    uint16_t inv = ~color;
-    setColumn(x, x);
-    setRow(y + YOFF, y + YOFF);
-    startRAM();
-    sendData(inv >> 8);
-    sendData(inv & 0xFF);
+    beginWindow(x, y, 1, 1);
+    pushColor(color, 1);
+    endWindow();
+}
+
+// ───── Glyph blitting ─────
+// Mirrors Adafruit_GFX::write() for the built-in font, but hands each
+// character to blitChar() instead of the per-pixel drawChar().
+size_t ST7365P_Display::write(uint8_t c) {
+    if (gfxFont) return Adafruit_GFX::write(c);   // custom GFX fonts: stock path
+
+    if (c == '\n') {
+        cursor_x  = 0;
+        cursor_y += textsize_y * 8;
+    } else if (c != '\r') {
+        if (wrap && (cursor_x + textsize_x * 6) > _width) {
+            cursor_x  = 0;
+            cursor_y += textsize_y * 8;
+        }
+        blitChar(cursor_x, cursor_y, c);
+        cursor_x += textsize_x * 6;
+    }
+    return 1;
+}
+
+void ST7365P_Display::blitChar(int16_t x, int16_t y, unsigned char c) {
+    const uint8_t  sx = textsize_x, sy = textsize_y;
+    const uint16_t fg = textcolor,  bg = textbgcolor;
+    const int16_t  cw = 6 * sx,     ch = 8 * sy;
+
+    if (x >= PANEL_W || y >= PANEL_H || x + cw <= 0 || y + ch <= 0) return;
+
+    glyphCell.cp437(_cp437);
+    glyphCell.drawChar(0, 0, c, 1, 0, 1);          // column 5 = spacing
+    const uint8_t* rows = glyphCell.getBuffer();    // one byte per row, MSB = x 0
+    uint8_t col[6];
+    for (uint8_t i = 0; i < 6; i++) {
+        col[i] = 0;
+        for (uint8_t j = 0; j < 8; j++)
+            if (rows[j] & (0x80 >> i)) col[i] |= 1 << j;
+    }
+
+    if (fg == bg) {
+        // Transparent text: one fill per vertical run of set pixels
+        for (uint8_t i = 0; i < 5; i++) {
+            uint8_t line = col[i], j = 0;
+            while (line) {
+                while (!(line & 1)) { line >>= 1; j++; }
+                uint8_t run = 0;
+                while (line & 1)    { line >>= 1; run++; }
+                fillRect(x + i * sx, y + j * sy, sx, run * sy, fg);
+                j += run;
+            }
+        }
+        return;
+    }
+
+    // Opaque text needs the whole cell on the panel
+    if (x < 0 || y < 0 || x + cw > PANEL_W || y + ch > PANEL_H) {
+        Adafruit_GFX::drawChar(x, y, c, fg, bg, sx, sy);
+        return;
+    }
+
+    // One window for the cell, pixels streamed as same-colour runs
+    beginWindow(x, y, cw, ch);
+    for (uint8_t j = 0; j < 8; j++) {
+        for (uint8_t r = 0; r < sy; r++) {
+            uint16_t runColor = (col[0] >> j) & 1 ? fg : bg;
+            uint16_t runLen   = 0;
+            for (uint8_t i = 0; i < 6; i++) {
+                uint16_t px = (col[i] >> j) & 1 ? fg : bg;
+                if (px != runColor) {
+                    pushColor(runColor, runLen);
+                    runColor = px;
+                    runLen   = 0;
+                }
+                runLen += sx;
+            }
+            pushColor(runColor, runLen);
+        }
+    }
+    endWindow();
+}
+
+// ───── RLE font strings ─────
+uint16_t ST7365P_Display::drawString(int16_t x, int16_t y, const char* utf8, const RleFont& font,
+                                     uint16_t fg, uint16_t bg, uint16_t minWidth) {
+    static const uint8_t MAX_GLYPHS = 48;
+    struct GlyphCursor {
+        const uint8_t* run;     // next run byte
+        uint8_t        left;    // pixels left in the current run
+        bool           on;      // current run is foreground
+        uint8_t        advance;
+    } g[MAX_GLYPHS];
+
+    if (x < 0 || y < 0 || x >= PANEL_W || y + font.height > PANEL_H) return 0;
+
+    uint8_t  n = 0;
+    uint16_t width = 0;
+    while (*utf8 && n < MAX_GLYPHS) {
+        const RleGlyph* gl = rleFindGlyph(font, utf8Next(utf8));
+        uint8_t adv = pgm_read_byte(&gl->advance);
+        if (x + width + adv > PANEL_W) break;
+        g[n].run     = font.runs + pgm_read_word(&gl->offset);
+        g[n].left    = 0;
+        g[n].on      = false;
+        g[n].advance = adv;
+        width += adv;
+        n++;
+    }
+    uint16_t total = width > minWidth ? width : minWidth;
+    if (x + total > PANEL_W) total = PANEL_W - x;
+    if (total == 0) return 0;
+
+    // Walk every glyph one cell row at a time; same-colour pixels are
+    // merged across glyph and row boundaries before they reach the bus.
+    uint16_t runColor = bg;
+    uint32_t runLen   = 0;
+    beginWindow(x, y, total, font.height);
+    for (uint8_t row = 0; row < font.height; row++) {
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t need = g[i].advance;
+            while (need) {
+                if (!g[i].left) {
+                    uint8_t r = pgm_read_byte(g[i].run++);
+                    g[i].on   = r & 0x80;
+                    g[i].left = (r & 0x7F) + 1;
+                }
+                uint8_t  take = g[i].left < need ? g[i].left : need;
+                uint16_t c    = g[i].on ? fg : bg;
+                if (c != runColor && runLen) {
+                    pushColor(runColor, runLen);
+                    runLen = 0;
+                }
+                runColor   = c;
+                runLen    += take;
+                g[i].left -= take;
+                need      -= take;
+            }
+        }
+        if (total > width) {                    // padding to minWidth
+            if (runColor != bg && runLen) {
+                pushColor(runColor, runLen);
+                runLen = 0;
+            }
+            runColor = bg;
+            runLen  += total - width;
+        }
+    }
+    if (runLen) pushColor(runColor, runLen);
+    endWindow();
+    return width;
 }
 
 // Text helpers that wrap Adafruit_GFX’s cursor/print API
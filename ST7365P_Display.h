@@ -5,10 +5,34 @@
 
 #include <Arduino.h>
 #include <Adafruit_GFX.h>
+#include "ST7365P_Transport.h"
+#include "RleFont.h"
+
+// 1 = count bus traffic per call site (see Stats below).  Leave at 0 for
+// release builds: every counter compiles out and timing is untouched.
+// Change it here, not per file: the class layout depends on it.
+#ifndef ST7365P_STATS
+#define ST7365P_STATS 0
+#endif
+
+#if ST7365P_STATS
+#define ST_STAT(field, n)  (stats[statSite].field += (n))
+#else
+#define ST_STAT(field, n)  ((void)0)
+#endif
+
+// Square sprite made of centred, nested horizontal spans (discs, rings…).
+// spans[row * layers + l] = half-width + 1 of layer l on that row (0 = none),
+// layers ordered outer → inner.  Colour 0 is the background, l + 1 layer l.
+struct SpanSprite {
+    uint8_t        size;       // odd: width = height
+    uint8_t        layers;
+    const uint8_t* spans;
+};
 
 class ST7365P_Display : public Adafruit_GFX {
 public:
-    ST7365P_Display();
+    explicit ST7365P_Display(ST7365P_Transport& bus);
 
     // Must call before any drawing
     void begin();
@@ -23,6 +47,58 @@ public:
     // Required Adafruit_GFX override
     void drawPixel(int16_t x, int16_t y, uint16_t color) override;
 
+    // Streaming pixel transaction: CS stays low from beginWindow() to
+    // endWindow(), pixels fill the window left→right, top→bottom.
+    void beginWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void pushColor(uint16_t color, uint32_t count);
+    void endWindow();
+
+    // Blit a span sprite in one window; colors[0..layers]
+    void drawSprite(int16_t x, int16_t y, const SpanSprite& sprite, const uint16_t* colors);
+
+    // Hardware vertical scrolling (VSCRDEF / VSCRSADD).  Rows [top, top+height)
+    // of the panel become a circular band; scrollTo(n) shows band line n at
+    // the top.  Drawing keeps addressing GRAM, i.e. unscrolled coordinates.
+    void setScrollRegion(uint16_t top, uint16_t height);
+    void scrollTo(uint16_t line);
+    void resetScroll();                    // whole GRAM, offset 0
+
+    // Panel power (DISPOFF+SLPIN / SLPOUT, DISPON).  GRAM and the scroll
+    // setup survive; drawing while asleep still lands in GRAM.  None of
+    // these wait: SLPIN and SLPOUT must be 120 ms apart (powerDelayMs()
+    // is what is left of that) and DISPON must come 5 ms after SLPOUT.
+    void sleep();
+    void sleepOut();
+    void displayOn();
+    uint32_t powerDelayMs() const;
+
+    // Text path: one address window per glyph cell instead of one per pixel
+    size_t write(uint8_t c) override;
+    using Adafruit_GFX::write;
+
+    // UTF-8 text in an RleFont: one window for the whole string, runs fed
+    // straight into the pixel stream.  The window is padded with `bg` out
+    // to `minWidth` (clears an old, longer string in the same pass).
+    // Returns the width of the text itself.
+    uint16_t drawString(int16_t x, int16_t y, const char* utf8, const RleFont& font,
+                        uint16_t fg, uint16_t bg, uint16_t minWidth = 0);
+
+#if ST7365P_STATS
+    // Traffic counters, one set per call site.  The caller picks the site
+    // (statSite); 0 collects everything not attributed to a site.
+    struct Stats {
+        uint32_t calls;        // times the site was entered
+        uint32_t commands;     // D/C = 0 words
+        uint32_t dataBytes;    // D/C = 1 words
+        uint32_t windows;      // CASET/RASET/RAMWR setups
+        uint32_t pixels;
+        uint32_t micros;       // CPU time inside the site
+    };
+    static const uint8_t STAT_SITES = 8;
+    Stats   stats[STAT_SITES] = {};
+    uint8_t statSite          = 0;
+#endif
+
     // Convenience text routines (wrap A‑GFX)
     void drawChar(int16_t x, int16_t y, char c, uint16_t color, uint8_t size);
     void drawText(int16_t x, int16_t y, const char* str, uint16_t color, uint8_t size);
@@ -30,18 +106,20 @@ public:
 private:
     void hwReset();
     void initDisplay();
-    void sendSPI9(uint8_t dc, uint8_t val);
     void sendCmd(uint8_t cmd);
     void sendData(uint8_t data);
-    void setColumn(uint16_t x0, uint16_t x1);
-    void setRow(uint16_t y0, uint16_t y1);
-    void startRAM();
+    void sendCmdArgs(uint8_t cmd, const uint8_t* args, uint8_t n);
+    void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+    void blitChar(int16_t x, int16_t y, unsigned char c);
+
+    ST7365P_Transport& bus;
+    uint16_t scrollTop    = 0;     // first band row in GRAM (incl. YOFF)
+    uint16_t scrollHeight = 0;
+    bool     asleep       = false;
+    uint32_t powerMs      = 0;     // last SLPIN / SLPOUT, for the 120 ms rule
 
-    // Pins
+    // Pins (CS/SCK/SDA belong to the transport)
     static const uint8_t PIN_RST = 5;     // PB11
-    static const uint8_t PIN_CS  = 0;     // PA22
-    static const uint8_t PIN_SCK = SCK;   // PA17
-    static const uint8_t PIN_SDA = MOSI;  // PA16
 
     // Panel geometry
     static const uint16_t PANEL_W = 480;
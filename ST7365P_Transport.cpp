@@ -0,0 +1,210 @@
+// ST7365P_Transport.cpp
+
+#include "ST7365P_Transport.h"
+
+#include "wiring_private.h"   // pinPeripheral()
+
+// Direct‐port writes for MKR Zero (SAMD21)
+#define WR_CS_LOW()   PORT->Group[PORTA].OUTCLR.reg = (1 << 22)
+#define WR_CS_HIGH()  PORT->Group[PORTA].OUTSET.reg = (1 << 22)
+#define WR_SCK_LOW()  PORT->Group[PORTA].OUTCLR.reg = (1 << 17)
+#define WR_SCK_HIGH() PORT->Group[PORTA].OUTSET.reg = (1 << 17)
+#define WR_SDA_LOW()  PORT->Group[PORTA].OUTCLR.reg = (1 << 16)
+#define WR_SDA_HIGH() PORT->Group[PORTA].OUTSET.reg = (1 << 16)
+
+// Pins
+static const uint8_t PIN_CS  = 0;     // PA22
+static const uint8_t PIN_SCK = SCK;   // PA17, SERCOM1 PAD1
+static const uint8_t PIN_SDA = MOSI;  // PA16, SERCOM1 PAD0
+
+/* ===================================================================== */
+/*  Bit-bang                                                             */
+/* ===================================================================== */
+static inline void pulseClock() {
+    WR_SCK_LOW();
+    WR_SCK_HIGH();
+}
+
+// One 9-bit word (D/C + 8 data bits, MSB first), fully unrolled.
+// CS must already be low.
+#define SPI9_BIT(on)  do { if (on) WR_SDA_HIGH(); else WR_SDA_LOW(); pulseClock(); } while (0)
+
+static inline void shift9(uint8_t dc, uint8_t val) {
+    SPI9_BIT(dc);
+    SPI9_BIT(val & 0x80);
+    SPI9_BIT(val & 0x40);
+    SPI9_BIT(val & 0x20);
+    SPI9_BIT(val & 0x10);
+    SPI9_BIT(val & 0x08);
+    SPI9_BIT(val & 0x04);
+    SPI9_BIT(val & 0x02);
+    SPI9_BIT(val & 0x01);
+}
+
+void ST7365P_BitBangTransport::begin() {
+    pinMode(PIN_CS,  OUTPUT);
+    pinMode(PIN_SCK, OUTPUT);
+    pinMode(PIN_SDA, OUTPUT);
+
+    WR_CS_HIGH();
+    WR_SCK_HIGH();
+    WR_SDA_HIGH();
+}
+
+void ST7365P_BitBangTransport::select() {
+    WR_CS_LOW();
+}
+
+void ST7365P_BitBangTransport::deselect() {
+    WR_CS_HIGH();
+}
+
+void ST7365P_BitBangTransport::write9(uint8_t dc, uint8_t val) {
+    shift9(dc, val);
+}
+
+void ST7365P_BitBangTransport::fillWords(uint16_t word, uint32_t count) {
+    uint8_t hi = word >> 8, lo = word & 0xFF;
+    while (count--) {
+        shift9(1, hi);
+        shift9(1, lo);
+    }
+}
+
+/* ===================================================================== */
+/*  SERCOM1 9-bit SPI + DMAC                                             */
+/* ===================================================================== */
+static const uint8_t DMA_CH = 0;
+
+// Channel 0 descriptor table and write-back area (16-byte aligned)
+static DmacDescriptor dmaDesc      __attribute__((aligned(16)));
+static DmacDescriptor dmaWriteback __attribute__((aligned(16)));
+
+static ST7365P_SercomTransport* dmaOwner = nullptr;
+
+extern "C" void DMAC_Handler(void) {
+    if (dmaOwner) dmaOwner->dmaIsr();
+}
+
+void ST7365P_SercomTransport::begin() {
+    dmaOwner = this;
+
+    pinMode(PIN_CS, OUTPUT);
+    WR_CS_HIGH();
+    pinPeripheral(PIN_SCK, PIO_SERCOM);
+    pinPeripheral(PIN_SDA, PIO_SERCOM);
+
+    // SCK idles high, panel latches on the rising edge → mode 3
+    sercom1.initSPI(SPI_PAD_0_SCK_1, SERCOM_RX_PAD_3, SPI_CHAR_SIZE_9_BITS, MSB_FIRST);
+    sercom1.initSPIClock(SERCOM_SPI_MODE_3, SPI_HZ);
+    sercom1.enableSPI();
+
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+    DMAC->BASEADDR.reg = (uint32_t)&dmaDesc;
+    DMAC->WRBADDR.reg  = (uint32_t)&dmaWriteback;
+    DMAC->CTRL.reg     = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+
+    DMAC->CHID.reg     = DMAC_CHID_ID(DMA_CH);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    DMAC->CHCTRLA.reg  = DMAC_CHCTRLA_SWRST;
+    DMAC->CHCTRLB.reg  = DMAC_CHCTRLB_LVL(0) |
+                         DMAC_CHCTRLB_TRIGSRC(SERCOM1_DMAC_ID_TX) |
+                         DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL;
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+void ST7365P_SercomTransport::waitIdle() {
+    while (dmaBusy) {}
+}
+
+void ST7365P_SercomTransport::startBlock(const uint16_t* src, uint16_t beats, bool srcInc) {
+    // With SRCINC the descriptor holds the address *after* the last beat
+    dmaDesc.BTCTRL.reg   = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_HWORD |
+                           (srcInc ? DMAC_BTCTRL_SRCINC : 0);
+    dmaDesc.BTCNT.reg    = beats;
+    dmaDesc.SRCADDR.reg  = (uint32_t)(srcInc ? src + beats : src);
+    dmaDesc.DSTADDR.reg  = (uint32_t)&SERCOM1->SPI.DATA.reg;
+    dmaDesc.DESCADDR.reg = 0;
+
+    dmaBusy   = true;
+    txPending = true;
+    DMAC->CHID.reg     = DMAC_CHID_ID(DMA_CH);
+    DMAC->CHCTRLA.reg |= DMAC_CHCTRLA_ENABLE;
+}
+
+void ST7365P_SercomTransport::dmaIsr() {
+    DMAC->CHID.reg      = DMAC_CHID_ID(DMA_CH);
+    DMAC->CHINTFLAG.reg = DMAC_CHINTFLAG_TCMPL;
+
+    if (fillLeft) {                               // next slice of a fill
+        uint32_t limit = fillPattern ? CHUNK * 2 : MAX_BEATS;
+        uint16_t beats = fillLeft > limit ? limit : fillLeft;
+        fillLeft -= beats;
+        startBlock(buf, beats, fillPattern);
+        return;
+    }
+
+    dmaBusy = false;
+    if (releaseCs) {
+        while (!SERCOM1->SPI.INTFLAG.bit.TXC) {}  // last word off the wire
+        WR_CS_HIGH();
+        releaseCs = false;
+        txPending = false;
+    }
+}
+
+void ST7365P_SercomTransport::putWord(uint16_t w9) {
+    while (!SERCOM1->SPI.INTFLAG.bit.DRE) {}
+    SERCOM1->SPI.DATA.reg = w9;
+    txPending = true;
+}
+
+void ST7365P_SercomTransport::select() {
+    waitIdle();
+    WR_CS_LOW();
+}
+
+void ST7365P_SercomTransport::deselect() {
+    noInterrupts();
+    if (dmaBusy) {                 // ISR raises CS when the burst ends
+        releaseCs = true;
+        interrupts();
+        return;
+    }
+    interrupts();
+
+    if (txPending) while (!SERCOM1->SPI.INTFLAG.bit.TXC) {}
+    WR_CS_HIGH();
+    txPending = false;
+}
+
+void ST7365P_SercomTransport::write9(uint8_t dc, uint8_t val) {
+    waitIdle();
+    putWord((dc ? 0x100 : 0) | val);
+}
+
+void ST7365P_SercomTransport::fillWords(uint16_t word, uint32_t count) {
+    waitIdle();
+    uint16_t hi = 0x100 | (word >> 8), lo = 0x100 | (word & 0xFF);
+    if (count < DMA_MIN) {
+        while (count--) { putWord(hi); putWord(lo); }
+        return;
+    }
+
+    // Same byte twice (black, white, …): one source word, no increment.
+    // Otherwise repeat a buffer of alternating hi/lo words.
+    fillPattern = (hi != lo);
+    if (fillPattern) {
+        for (uint16_t i = 0; i < CHUNK; i++) { buf[2 * i] = hi; buf[2 * i + 1] = lo; }
+    } else {
+        buf[0] = hi;
+    }
+
+    uint32_t beats = count * 2;
+    uint32_t limit = fillPattern ? CHUNK * 2 : MAX_BEATS;
+    uint16_t first = beats > limit ? limit : beats;
+    fillLeft = beats - first;
+    startBlock(buf, first, fillPattern);
+}
@@ -0,0 +1,68 @@
+// ST7365P_Transport.h
+
+#ifndef ST7365P_TRANSPORT_H
+#define ST7365P_TRANSPORT_H
+
+#include <Arduino.h>
+
+// 3-wire link to the ST7365P: every word on the wire is 9 bits,
+// D/C first, then 8 data bits MSB first.  ST7365P_Display only talks
+// to this interface; the implementations below decide how bits move.
+class ST7365P_Transport {
+public:
+    virtual void begin() = 0;
+
+    // CS low.  Waits for a previous asynchronous burst to finish first.
+    virtual void select() = 0;
+    // CS high once everything queued has been shifted out.  May return
+    // before that on asynchronous transports; the next select() waits.
+    virtual void deselect() = 0;
+
+    virtual void write9(uint8_t dc, uint8_t val) = 0;
+
+    // `count` copies of the same 16-bit word, two D/C=1 bytes each
+    virtual void fillWords(uint16_t word, uint32_t count) = 0;
+};
+
+// Direct-port bit-bang on PA22 (CS) / PA17 (SCK) / PA16 (SDA)
+class ST7365P_BitBangTransport : public ST7365P_Transport {
+public:
+    void begin() override;
+    void select() override;
+    void deselect() override;
+    void write9(uint8_t dc, uint8_t val) override;
+    void fillWords(uint16_t word, uint32_t count) override;
+};
+
+// SERCOM1 in SPI mode 3 with 9-bit characters.  Bulk fills go out
+// through DMAC channel 0; fills return immediately and release CS
+// from the DMA interrupt.
+class ST7365P_SercomTransport : public ST7365P_Transport {
+public:
+    void begin() override;
+    void select() override;
+    void deselect() override;
+    void write9(uint8_t dc, uint8_t val) override;
+    void fillWords(uint16_t word, uint32_t count) override;
+
+    void dmaIsr();                          // called from DMAC_Handler()
+
+private:
+    static const uint32_t SPI_HZ     = 12000000;
+    static const uint16_t CHUNK      = 128;  // pixels per DMA staging buffer
+    static const uint16_t DMA_MIN    = 16;   // shorter bursts are written by the CPU
+    static const uint16_t MAX_BEATS  = 65534;
+
+    void waitIdle();
+    void startBlock(const uint16_t* src, uint16_t beats, bool srcInc);
+    void putWord(uint16_t w9);
+
+    uint16_t          buf[CHUNK * 2];        // 9-bit words, D/C in bit 8
+    volatile bool     dmaBusy     = false;
+    volatile bool     releaseCs   = false;
+    volatile uint32_t fillLeft    = 0;       // beats still to queue for a fill
+    volatile bool     fillPattern = false;   // alternating hi/lo buffer vs one word
+    bool              txPending   = false;
+};
+
+#endif
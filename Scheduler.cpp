@@ -0,0 +1,106 @@
+#include "Scheduler.h"
+
+struct Task {
+  const char* name;
+  TaskFn      fn;
+  uint32_t    period;
+  uint32_t    budget;
+  uint32_t    release;     // next release time (µs)
+  bool        critical;
+  TaskStats   st;
+};
+
+static Task    tasks[MAX_TASKS];
+static uint8_t count    = 0;
+static bool    yielding = false;
+
+int8_t taskAdd(const char* name, TaskFn fn, uint32_t periodUs,
+               uint32_t budgetUs, bool critical)
+{
+  if (count >= MAX_TASKS) return -1;
+  Task& t    = tasks[count];
+  t.name     = name;
+  t.fn       = fn;
+  t.period   = periodUs;
+  t.budget   = budgetUs;
+  t.release  = micros();
+  t.critical = critical;
+  t.st       = TaskStats();
+  return count++;
+}
+
+static void runTask(Task& t, uint32_t now)
+{
+  const uint32_t deadline = t.release + t.period;
+
+  t.fn();
+
+  const uint32_t end = micros();
+  const uint32_t us  = end - now;
+  t.st.runs++;
+  t.st.totalUs += us;
+  if (us > t.st.worstUs) t.st.worstUs = us;
+  if (us > t.budget)     t.st.overruns++;
+  if ((int32_t)(end - deadline) > 0) t.st.misses++;
+
+  /* next release; after a long stall skip ahead instead of bursting */
+  t.release += t.period;
+  if ((int32_t)(end - t.release) >= (int32_t)t.period) {
+    t.st.misses += (end - t.release) / t.period;
+    t.release = end;
+  }
+}
+
+/* ready task with the earliest deadline, or -1 */
+static int8_t pick(uint32_t now, bool criticalOnly)
+{
+  int8_t   best   = -1;
+  int32_t  bestDl = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    const Task& t = tasks[i];
+    if (criticalOnly && !t.critical) continue;
+    if ((int32_t)(now - t.release) < 0) continue;
+    const int32_t dl = (int32_t)(t.release + t.period - now);
+    if (best < 0 || dl < bestDl) { best = i; bestDl = dl; }
+  }
+  return best;
+}
+
+void schedulerRun()
+{
+  const uint32_t now = micros();
+  const int8_t i = pick(now, false);
+  if (i >= 0) runTask(tasks[i], now);
+}
+
+void schedulerYield()
+{
+  if (yielding) return;
+  yielding = true;
+  for (uint32_t now = micros(); ; now = micros()) {
+    const int8_t i = pick(now, true);
+    if (i < 0) break;
+    runTask(tasks[i], now);
+  }
+  yielding = false;
+}
+
+void dumpTaskStats()
+{
+  char line[96];
+  Serial.println(F("[SCH] task          period  budget    runs  overrun    miss   worst     avg"));
+  for (uint8_t i = 0; i < count; ++i) {
+    const Task& t = tasks[i];
+    snprintf(line, sizeof(line), "[SCH] %-12s %7lu %7lu %7lu %8lu %7lu %7lu %7lu",
+             t.name, (unsigned long)t.period, (unsigned long)t.budget,
+             (unsigned long)t.st.runs, (unsigned long)t.st.overruns,
+             (unsigned long)t.st.misses, (unsigned long)t.st.worstUs,
+             (unsigned long)t.st.avgUs());
+    Serial.println(line);
+  }
+}
+
+void resetTaskStats()
+{
+  for (uint8_t i = 0; i < count; ++i) tasks[i].st = TaskStats();
+}
@@ -0,0 +1,37 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+/* ────────────────────────────────────────────
+   Cooperative earliest-deadline-first task
+   scheduler.  Each task is released every
+   `period` µs and is due one period later;
+   the ready task with the nearest deadline
+   runs first.  Run times are measured against
+   the task's budget.                          */
+
+typedef void (*TaskFn)();
+
+#define MAX_TASKS  12
+
+struct TaskStats {
+  uint32_t runs;
+  uint32_t overruns;      // ran longer than its budget
+  uint32_t misses;        // finished after its deadline / skipped releases
+  uint32_t worstUs;
+  uint32_t totalUs;       // sum of run times, for the average
+  uint32_t avgUs() const { return runs ? totalUs / runs : 0; }
+};
+
+/* critical tasks also run from schedulerYield(), i.e. inside long UI and
+   EEPROM work */
+int8_t  taskAdd(const char* name, TaskFn fn, uint32_t periodUs,
+                uint32_t budgetUs, bool critical = false);   // -1 when full
+void    schedulerRun();                  // call from loop(): one dispatch
+void    schedulerYield();                // from long UI / EEPROM work: critical tasks only
+
+void    dumpTaskStats();                 // table over Serial
+void    resetTaskStats();
+
+#endif
@@ -0,0 +1,57 @@
+// Tca9555.cpp
+
+#include "Tca9555.h"
+#include <Wire.h>
+
+uint8_t Tca9555::readPair(uint8_t reg, uint8_t* dst) {
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    Wire.endTransmission(false);
+    const uint8_t n = Wire.requestFrom(addr, (uint8_t)2);
+    for (uint8_t i = 0; i < n && i < 2; ++i) dst[i] = Wire.read();
+    return n;
+}
+
+void Tca9555::writeShadow(uint8_t reg, uint8_t* shadow, uint8_t port, uint8_t val) {
+    port &= 1;
+    if (shadow[port] == val) return;
+    shadow[port] = val;
+    Wire.beginTransmission(addr);
+    Wire.write(reg + port);
+    Wire.write(val);
+    Wire.endTransmission();
+}
+
+void Tca9555::begin() {
+    readPair(REG_OUTPUT,   out);
+    readPair(REG_POLARITY, pol);
+    readPair(REG_CONFIG,   cfg);
+}
+
+void Tca9555::setInput(uint8_t port, uint8_t bit, bool input) {
+    const uint8_t m = 1 << bit;
+    setConfig(port, input ? (config(port) | m) : (config(port) & ~m));
+}
+
+void Tca9555::setLevel(uint8_t port, uint8_t bit, bool high) {
+    const uint8_t m = 1 << bit;
+    setOutput(port, high ? (output(port) | m) : (output(port) & ~m));
+}
+
+uint16_t Tca9555::readInputs() {
+    uint8_t in[2] = { 0xFF, 0xFF };
+    readPair(REG_INPUT, in);
+    return in[0] | (uint16_t)in[1] << 8;
+}
+
+TcaPorts Tca9555::snapshot() {
+    return snapshot(readInputs());
+}
+
+TcaPorts Tca9555::snapshot(uint16_t input) const {
+    TcaPorts s;
+    s.input  = input;
+    s.output = out[0] | (uint16_t)out[1] << 8;
+    s.config = cfg[0] | (uint16_t)cfg[1] << 8;
+    return s;
+}
@@ -0,0 +1,66 @@
+// Tca9555.h
+
+#ifndef TCA9555_H
+#define TCA9555_H
+
+#include <Arduino.h>
+
+// Both 8-bit ports of the expander as one 16-bit word each,
+// port 1 in the high byte (pin p = port * 8 + bit)
+struct TcaPorts {
+    uint16_t input;      // pin levels as read
+    uint16_t output;     // output latch
+    uint16_t config;     // 1 = input (Hi-Z), 0 = driven
+
+    static constexpr uint16_t mask(uint8_t port, uint8_t bit) { return (uint16_t)1 << (port * 8 + bit); }
+
+    bool level (uint8_t port, uint8_t bit) const { return input  & mask(port, bit); }
+    bool latch (uint8_t port, uint8_t bit) const { return output & mask(port, bit); }
+    bool driven(uint8_t port, uint8_t bit) const { return !(config & mask(port, bit)); }
+};
+
+// TCA9555 16-bit I²C expander with shadowed output, polarity and config
+// registers.  Setters only touch the bus when the register value actually
+// changes, getters for those registers never do, and both input ports
+// come in with one two-byte read (the chip auto-increments within a
+// register pair).
+class Tca9555 {
+public:
+    explicit Tca9555(uint8_t addr = 0x20) : addr(addr) {}
+
+    // Load the shadows from the chip (three pair reads)
+    void begin();
+
+    // Whole-port writes; skipped when the shadow already matches
+    void setConfig  (uint8_t port, uint8_t val) { writeShadow(REG_CONFIG,   cfg, port, val); }
+    void setOutput  (uint8_t port, uint8_t val) { writeShadow(REG_OUTPUT,   out, port, val); }
+    void setPolarity(uint8_t port, uint8_t val) { writeShadow(REG_POLARITY, pol, port, val); }
+
+    // Single pin, same rules
+    void setInput(uint8_t port, uint8_t bit, bool input);
+    void setLevel(uint8_t port, uint8_t bit, bool high);
+
+    uint8_t config  (uint8_t port) const { return cfg[port & 1]; }
+    uint8_t output  (uint8_t port) const { return out[port & 1]; }
+    uint8_t polarity(uint8_t port) const { return pol[port & 1]; }
+
+    // One bus transaction for both input ports
+    uint16_t readInputs();
+    // Inputs plus the shadowed registers, for callers that test several pins
+    TcaPorts snapshot();
+    // Same, around input levels the caller already has (no bus traffic)
+    TcaPorts snapshot(uint16_t input) const;
+
+private:
+    enum : uint8_t { REG_INPUT = 0, REG_OUTPUT = 2, REG_POLARITY = 4, REG_CONFIG = 6 };
+
+    void    writeShadow(uint8_t reg, uint8_t* shadow, uint8_t port, uint8_t val);
+    uint8_t readPair(uint8_t reg, uint8_t* dst);
+
+    uint8_t addr;
+    uint8_t out[2] = { 0xFF, 0xFF };     // power-on defaults
+    uint8_t pol[2] = { 0x00, 0x00 };
+    uint8_t cfg[2] = { 0xFF, 0xFF };
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "TimerService.h"
+
+struct TimerSlot {
+  uint32_t      due;
+  TimerCallback fn;
+  uint8_t       gen;                    // bumped on every reuse
+  bool          active;
+};
+
+static TimerSlot slots[TIMER_SLOTS];
+
+static TimerId makeId(uint8_t slot) { return (uint16_t)slots[slot].gen << 8 | (slot + 1); }
+
+static TimerSlot* lookup(TimerId id)
+{
+  const uint8_t slot = (id & 0xFF) - 1;
+  if (id == TIMER_NONE || slot >= TIMER_SLOTS) return nullptr;
+  TimerSlot& t = slots[slot];
+  return (t.active && t.gen == (id >> 8)) ? &t : nullptr;
+}
+
+TimerId timerAfter(uint32_t ms, TimerCallback fn)
+{
+  for (uint8_t i = 0; i < TIMER_SLOTS; ++i) {
+    TimerSlot& t = slots[i];
+    if (t.active) continue;
+    t.gen++;
+    t.due    = millis() + ms;
+    t.fn     = fn;
+    t.active = true;
+    return makeId(i);
+  }
+  return TIMER_NONE;
+}
+
+void timerCancel(TimerId& id)
+{
+  if (TimerSlot* t = lookup(id)) t->active = false;
+  id = TIMER_NONE;
+}
+
+void serviceTimers()
+{
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < TIMER_SLOTS; ++i) {
+    TimerSlot& t = slots[i];
+    if (!t.active || (int32_t)(now - t.due) < 0) continue;
+    t.active = false;                   // free first: fn may re-arm
+    t.fn();
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef TIMER_SERVICE_H
+#define TIMER_SERVICE_H
+
+#include <Arduino.h>
+
+/* ────────────────────────────────────────────
+   One-shot millisecond timers, run from loop().
+   Callbacks execute in loop context, so they
+   may use I²C and the display.                */
+
+typedef void (*TimerCallback)();
+typedef uint16_t TimerId;               // slot + generation, 0 = none
+
+#define TIMER_NONE   0
+#define TIMER_SLOTS  8
+
+TimerId timerAfter(uint32_t ms, TimerCallback fn);  // TIMER_NONE when full
+void    timerCancel(TimerId& id);                   // clears id
+void    serviceTimers();                            // call every loop()
+
+#endif
@@ -0,0 +1,246 @@
+#include "TripLog.h"
+#include "EepromManager.h"
+#include "RecordStore.h"        // crc16Ccitt()
+#include "InterlockManager.h"
+#include "AuxManager.h"         // auxState: is an auto-reset armed
+
+/* ring geometry: TRIP_LOG_ADDR is page aligned, records never straddle */
+static const uint32_t SLOTS         = TRIP_LOG_SIZE / sizeof(TripRecord);
+static const uint8_t  PER_PAGE      = EEPROM_PAGE_SIZE / sizeof(TripRecord);
+static const uint8_t  PER_WRITE     = EEPROM_WRITE_CHUNK / sizeof(TripRecord);
+static const uint8_t  CRC_BYTES     = sizeof(TripRecord) - 2;
+static_assert(TRIP_LOG_ADDR % EEPROM_PAGE_SIZE == 0 && TRIP_LOG_SIZE % EEPROM_PAGE_SIZE == 0,
+              "trip log must cover whole pages");
+
+static uint32_t   originSeq    = 1;     // a seq that lands in slot 0
+static uint32_t   firstSeq     = 1;     // oldest record of the current run
+static uint32_t   lastSeq      = 0;     // newest record, 0 = log empty
+static uint32_t   writtenSeq   = 0;     // newest record in EEPROM
+static uint32_t   firstQueueMs = 0;     // when the oldest queued record came in
+static uint16_t   dropped      = 0;
+static TripRecord queue[TRIP_LOG_QUEUE];  // by seq % TRIP_LOG_QUEUE
+
+static uint32_t slotOf(uint32_t seq)
+{
+  int32_t d = (int32_t)(seq - originSeq) % (int32_t)SLOTS;
+  return d < 0 ? d + SLOTS : d;
+}
+
+static uint32_t slotAddr(uint32_t slot) { return TRIP_LOG_ADDR + slot * sizeof(TripRecord); }
+
+static bool valid(const TripRecord& r)
+{
+  return r.seq != 0xFFFFFFFFUL && crc16Ccitt(&r, CRC_BYTES) == r.crc;
+}
+
+static bool readSlot(uint32_t slot, TripRecord& r)
+{
+  return eepromReadBlock(slotAddr(slot), &r, sizeof(r)) && valid(r);
+}
+
+static uint32_t oldestSeq()
+{
+  const uint32_t ring = lastSeq > SLOTS ? lastSeq - SLOTS + 1 : 1;
+  return ring > firstSeq ? ring : firstSeq;
+}
+
+/* the next queued records within one page, as one write transaction */
+static bool writeQueued()
+{
+  if (writtenSeq == lastSeq) return false;
+  const uint32_t slot = slotOf(writtenSeq + 1);
+  uint32_t n = PER_PAGE - slot % PER_PAGE;
+  if (n > lastSeq - writtenSeq) n = lastSeq - writtenSeq;
+  if (n > PER_WRITE)            n = PER_WRITE;
+
+  TripRecord buf[PER_WRITE];
+  for (uint32_t i = 0; i < n; ++i)
+    buf[i] = queue[(writtenSeq + 1 + i) % TRIP_LOG_QUEUE];
+  eepromWriteBlock(slotAddr(slot), buf, n * sizeof(TripRecord));
+  writtenSeq += n;
+  if ((slot + n) % PER_PAGE == 0)
+    firstQueueMs = millis();            // page done: the rest starts its wait now
+  return true;
+}
+
+static void onChange(const InterlockEvent& ev)
+{
+  const uint16_t diff = (ev.before ^ ev.after) & SIM_PINS;
+  if (!diff) return;                                  // reset pulse pins
+
+  const uint16_t real = (tca.config(0) | (uint16_t)tca.config(1) << 8) & diff;   // 1 = input
+  TripCause cause = TRIP_CAUSE_SIM;
+  if (real & ~ev.after) cause = TRIP_CAUSE_TRIP;      // active LOW
+  else if (real)        cause = TRIP_CAUSE_CLEAR;
+
+  const bool armed = cause == TRIP_CAUSE_TRIP && auxState.autoResetEnable &&
+                     !(ev.after & GLOBAL_PIN);
+  tripLogAppend(cause, armed ? TRIP_ACTION_ARMED : TRIP_ACTION_NONE, ev.before, ev.after);
+}
+
+/* the record gets the next sequence number; false if the queue is full */
+static bool enqueue(TripRecord r)
+{
+  if (lastSeq - writtenSeq >= TRIP_LOG_QUEUE) { dropped++; return false; }
+  if (lastSeq == writtenSeq) firstQueueMs = millis();
+
+  r.seq = ++lastSeq;
+  r.crc = crc16Ccitt(&r, CRC_BYTES);
+  queue[r.seq % TRIP_LOG_QUEUE] = r;
+  return true;
+}
+
+/* binary search for the newest record in EEPROM */
+static void findHead()
+{
+  TripRecord r0, r;
+  originSeq = 1;
+  firstSeq  = 1;
+  lastSeq   = 0;
+
+  if (!readSlot(0, r0)) {
+    // blank log, or slot 0 torn right after a wrap: then the last slot
+    // holds the newest record
+    if (readSlot(SLOTS - 1, r)) {
+      lastSeq   = r.seq;
+      originSeq = r.seq - (SLOTS - 1);
+      firstSeq  = originSeq;
+    }
+  } else {
+    // slots 0..head carry r0.seq, r0.seq + 1, ...; the rest is older
+    uint32_t lo = 0, hi = SLOTS - 1;
+    while (lo < hi) {
+      const uint32_t mid = lo + (hi - lo + 1) / 2;
+      if (readSlot(mid, r) && r.seq == r0.seq + mid) lo = mid;
+      else                                            hi = mid - 1;
+    }
+    originSeq = r0.seq;
+    lastSeq   = r0.seq + lo;
+    firstSeq  = r0.seq;
+    // has the run wrapped: the slot after the head is its oldest record
+    if (lo + 1 < SLOTS && readSlot(lo + 1, r) && r.seq == lastSeq - SLOTS + 1)
+      firstSeq = r.seq;
+  }
+  writtenSeq = lastSeq;
+}
+
+// ───── Public API ─────
+
+void initTripLog()
+{
+  findHead();
+  Serial.print("[TRIPLOG] "); Serial.print(tripLogCount());
+  Serial.print(" records, head #"); Serial.println(lastSeq);
+
+  const uint16_t in = interlockInputs();
+  tripLogAppend(TRIP_CAUSE_BOOT, TRIP_ACTION_NONE, in, in);
+  addInterlockListener(onChange);
+}
+
+void tripLogAppend(TripCause cause, TripAction action, uint16_t before, uint16_t after)
+{
+  TripRecord r;
+  r.timeMs = millis();
+  r.before = before;
+  r.after  = after;
+  r.cause  = cause;
+  r.action = action;
+  enqueue(r);
+}
+
+/* a page is written once it is full or its oldest record is due */
+void serviceTripLog()
+{
+  if (writtenSeq == lastSeq || eepromFormatBusy()) return;
+  const bool pageFull = slotOf(writtenSeq + 1) % PER_PAGE + (lastSeq - writtenSeq) >= PER_PAGE;
+  if (!pageFull && millis() - firstQueueMs < TRIP_LOG_FLUSH_MS) return;
+  if (!eepromReady()) return;           // don't sit in ACK polling
+  writeQueued();
+}
+
+void tripLogFlush()
+{
+  while (writeQueued()) {}
+  eepromSync();
+}
+
+/* queued records keep their contents and are renumbered after the head.
+   A cut ring still holds older records above the cut: a run restarted
+   at seq 1 could line up with them, so it restarts at slot 0 above
+   everything written and its first record (a FORMAT marker) goes out
+   at once.                                                             */
+void tripLogAfterFormat(bool cut)
+{
+  TripRecord q[TRIP_LOG_QUEUE];
+  uint8_t n = 0;
+  for (uint32_t s = writtenSeq + 1; s <= lastSeq; ++s) q[n++] = queue[s % TRIP_LOG_QUEUE];
+
+  if (cut && writtenSeq) {
+    originSeq = writtenSeq + 1;
+    firstSeq  = originSeq;
+    lastSeq   = writtenSeq;
+    const uint16_t in = interlockInputs();
+    tripLogAppend(TRIP_CAUSE_FORMAT, TRIP_ACTION_NONE, in, in);
+    writeQueued();
+  } else {
+    findHead();
+  }
+  for (uint8_t i = 0; i < n; ++i) enqueue(q[i]);
+}
+
+uint32_t tripLogCount()
+{
+  return lastSeq ? lastSeq - oldestSeq() + 1 : 0;
+}
+
+void dumpTripLog(uint16_t n)
+{
+  static const char* const causes[]  = { "boot", "trip", "clear", "sim", "reset", "format" };
+  static const char* const actions[] = { "", "auto-reset armed", "auto pulse", "manual pulse" };
+  char line[80];
+  TripRecord r;
+  TripLogReader rd;
+
+  Serial.print("[TRIPLOG] "); Serial.print(tripLogCount());
+  Serial.print(" records, "); Serial.print(dropped); Serial.println(" dropped");
+  while (n-- && rd.prev(r)) {
+    snprintf(line, sizeof(line), "[TRIPLOG] #%lu %10lu ms  %04X -> %04X  %-5s %s",
+             (unsigned long)r.seq, (unsigned long)r.timeMs, r.before, r.after,
+             r.cause  < 6 ? causes[r.cause]   : "?",
+             r.action < 4 ? actions[r.action] : "?");
+    Serial.println(line);
+  }
+}
+
+// ───── Reverse reader ─────
+
+TripLogReader::TripLogReader() : seq(lastSeq), oldest(oldestSeq()), cacheSeq(0) {}
+
+bool TripLogReader::prev(TripRecord& r)
+{
+  if (!seq || seq < oldest) return false;
+
+  if (seq > writtenSeq) {                             // still queued
+    r = queue[seq % TRIP_LOG_QUEUE];
+    seq--;
+    return true;
+  }
+
+  if (!cached || seq < cacheSeq || seq >= cacheSeq + cached) {
+    // this record and up to BURST - 1 older ones, without wrapping the ring
+    const uint32_t slot = slotOf(seq);
+    uint32_t k = TRIP_LOG_BURST;
+    if (k > seq - oldest + 1) k = seq - oldest + 1;
+    if (k > slot + 1)         k = slot + 1;
+    cached   = 0;
+    if (!eepromReadBlock(slotAddr(slot + 1 - k), cache, k * sizeof(TripRecord))) { seq = 0; return false; }
+    cacheSeq = seq + 1 - k;
+    cached   = k;
+  }
+
+  const TripRecord& c = cache[seq - cacheSeq];
+  if (c.seq != seq || !valid(c)) { seq = 0; return false; }   // torn or overwritten
+  r = c;
+  seq--;
+  return true;
+}
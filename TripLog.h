@@ -0,0 +1,71 @@
+#ifndef TRIP_LOG_H
+#define TRIP_LOG_H
+
+#include <Arduino.h>
+
+/* ────────────────────────────────────────────
+   Persistent trip log: an append-only ring of
+   16-byte records over the EEPROM above the
+   settings store.  Events are queued in RAM
+   from the INT path and written by
+   serviceTripLog() a page at a time, one
+   32-byte write per call.  On
+   boot the head is found by binary search on
+   the sequence numbers (16 record reads).     */
+
+enum TripCause : uint8_t {
+  TRIP_CAUSE_BOOT  = 0,     // power-up, marks where timeMs restarts
+  TRIP_CAUSE_TRIP  = 1,     // a real input went active
+  TRIP_CAUSE_CLEAR = 2,     // real inputs released only
+  TRIP_CAUSE_SIM   = 3,     // only simulated (driven) pins changed
+  TRIP_CAUSE_RESET = 4,     // reset pulse sent
+  TRIP_CAUSE_FORMAT = 5,    // format cancelled inside the ring: log restarts here
+};
+
+enum TripAction : uint8_t {
+  TRIP_ACTION_NONE         = 0,
+  TRIP_ACTION_ARMED        = 1,   // auto-reset will pulse after its delay
+  TRIP_ACTION_PULSE_AUTO   = 2,
+  TRIP_ACTION_PULSE_MANUAL = 3,
+};
+
+struct __attribute__((packed)) TripRecord {
+  uint32_t seq;          // 1, 2, ... since the last format
+  uint32_t timeMs;       // millis() since the preceding BOOT record
+  uint16_t before;       // filtered input levels, active LOW
+  uint16_t after;
+  uint8_t  cause;        // TripCause
+  uint8_t  action;       // TripAction
+  uint16_t crc;          // CRC-16 over the bytes above
+};
+static_assert(sizeof(TripRecord) == 16, "trip record layout changed");
+
+#define TRIP_LOG_QUEUE     32     // records held in RAM until written
+#define TRIP_LOG_FLUSH_MS  1000   // a partial page waits at most this long
+
+void     initTripLog();           // after initEeprom(): head search, BOOT record
+void     serviceTripLog();        // scheduler task: at most one write transaction
+void     tripLogFlush();          // write everything queued, wait for the cycle
+void     tripLogAfterFormat(bool cut);   // erased; cut = stopped inside the ring
+void     tripLogAppend(TripCause cause, TripAction action, uint16_t before, uint16_t after);
+uint32_t tripLogCount();          // records available, newest first
+void     dumpTripLog(uint16_t n); // newest n records to Serial
+
+/* Walks the log from the newest record back.  EEPROM records come in
+   with one sequential read per TRIP_LOG_BURST, queued ones from RAM.  */
+class TripLogReader {
+public:
+  TripLogReader();
+  bool prev(TripRecord& r);       // false once the oldest has been returned
+
+private:
+  static const uint8_t TRIP_LOG_BURST = 8;
+
+  uint32_t   seq;                 // next record to return, 0 = done
+  uint32_t   oldest;              // older ones have been overwritten
+  uint32_t   cacheSeq;            // seq of cache[0]
+  uint8_t    cached = 0;
+  TripRecord cache[TRIP_LOG_BURST];
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "TripStats.h"
+#include "InterlockManager.h"
+
+static TripStats stats[INTERLOCK_COUNT];
+static uint16_t  dirty = 0;             // bit per channel index
+
+uint32_t TripStats::perHourX10(uint32_t nowMs) const
+{
+  return nowMs ? (uint32_t)((uint64_t)count * 36000000UL / nowMs) : 0;
+}
+
+static void onChange(const InterlockEvent& ev)
+{
+  const uint16_t real = tca.config(0) | (uint16_t)tca.config(1) << 8;   // 1 = input
+  const uint16_t diff = (ev.before ^ ev.after) & real;
+  if (!diff) return;
+  const uint32_t now = millis();
+
+  for (uint8_t i = 0; i < INTERLOCK_COUNT; ++i) {
+    const uint16_t m = interlocks[i].mask();
+    if (!(diff & m) || !interlocks[i].allowSim) continue;
+    TripStats& s = stats[i];
+
+    if (!(ev.after & m)) {                          // active LOW: trip
+      s.count++;
+      s.lastTripMs = now;
+      s.startMs    = now;
+      s.active     = true;
+    } else if (s.active) {                          // release
+      const uint32_t d = now - s.startMs;
+      if (!s.closed || d < s.minMs) s.minMs = d;
+      if (d > s.maxMs) s.maxMs = d;
+      s.sumMs += d;
+      s.closed++;
+      s.active = false;
+    }
+    dirty |= 1u << i;
+  }
+}
+
+void initTripStats()
+{
+  addInterlockListener(onChange);
+}
+
+const TripStats& tripStats(uint8_t idx)
+{
+  return stats[idx < INTERLOCK_COUNT ? idx : 0];
+}
+
+uint16_t takeTripStatsDirty()
+{
+  const uint16_t d = dirty;
+  dirty = 0;
+  return d;
+}
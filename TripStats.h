@@ -0,0 +1,27 @@
+#ifndef TRIP_STATS_H
+#define TRIP_STATS_H
+
+#include <Arduino.h>
+
+/* ────────────────────────────────────────────
+   Per-channel trip statistics, updated in O(1)
+   from interlock change events.  Simulated
+   (driven) pins are not counted.              */
+
+struct TripStats {
+  uint16_t count;        // trips since boot
+  uint16_t closed;       // trips that have released (have a duration)
+  uint32_t lastTripMs;   // millis() of the last trip
+  uint32_t startMs;      // of the trip in progress
+  uint32_t minMs, maxMs, sumMs;
+  bool     active;
+
+  uint32_t meanMs() const { return closed ? sumMs / closed : 0; }
+  uint32_t perHourX10(uint32_t nowMs) const;   // tenths of trips per hour
+};
+
+void             initTripStats();
+const TripStats& tripStats(uint8_t idx);        // idx into interlocks[]
+uint16_t         takeTripStatsDirty();          // channels changed since last call
+
+#endif
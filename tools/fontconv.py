@@ -0,0 +1,285 @@
+# fontconv.py - TrueType -> run-length encoded flash font for ST7365P_Display
+#
+#   python3 tools/fontconv.py <font.ttf> <pixel-size> <name> [out.cpp]
+#
+# Every glyph is rasterised into a cell of  advance x lineHeight  pixels
+# (4x4 supersampled, 50 % coverage threshold) and that cell is stored
+# row-major as runs.  One byte per run:
+#     bit 7      1 = foreground, 0 = background
+#     bits 6..0  run length - 1   (1..128 pixels)
+# so the renderer can feed runs straight into pushColor() with no
+# per-pixel work.  The output is a .cpp defining `const RleFont <name>`;
+# commit it next to the sketch, Arduino has no pre-build step to run this.
+
+import struct
+import sys
+
+CHARSET = (list(range(0x20, 0x7F)) +
+           [0x00B0,   # °
+            0x00B5,   # µ
+            0x0394,   # Δ
+            0x03A9,   # Ω
+            0x2026])  # …
+
+SS = 4  # supersampling per axis
+
+
+class TrueType:
+    def __init__(self, path):
+        self.data = open(path, 'rb').read()
+        num = struct.unpack_from('>H', self.data, 4)[0]
+        self.tables = {}
+        for i in range(num):
+            tag, _, off, length = struct.unpack_from('>4sIII', self.data, 12 + 16 * i)
+            self.tables[tag.decode('latin-1')] = (off, length)
+
+        head = self.tables['head'][0]
+        self.unitsPerEm = struct.unpack_from('>H', self.data, head + 18)[0]
+        self.locFormat = struct.unpack_from('>h', self.data, head + 50)[0]
+
+        hhea = self.tables['hhea'][0]
+        self.ascent, self.descent = struct.unpack_from('>hh', self.data, hhea + 4)
+        self.numHMetrics = struct.unpack_from('>H', self.data, hhea + 34)[0]
+        self.numGlyphs = struct.unpack_from('>H', self.data, self.tables['maxp'][0] + 4)[0]
+        self.cmap = self._parseCmap()
+
+    def _parseCmap(self):
+        base = self.tables['cmap'][0]
+        n = struct.unpack_from('>H', self.data, base + 2)[0]
+        for i in range(n):
+            pid, eid, off = struct.unpack_from('>HHI', self.data, base + 4 + 8 * i)
+            if pid == 3 and eid == 1:
+                return self._cmap4(base + off)
+        raise ValueError('no Unicode BMP cmap')
+
+    def _cmap4(self, off):
+        segX2 = struct.unpack_from('>H', self.data, off + 6)[0]
+        seg = segX2 // 2
+        ends = struct.unpack_from('>%dH' % seg, self.data, off + 14)
+        starts = struct.unpack_from('>%dH' % seg, self.data, off + 16 + segX2)
+        deltas = struct.unpack_from('>%dh' % seg, self.data, off + 16 + 2 * segX2)
+        rangeOff = off + 16 + 3 * segX2
+        ranges = struct.unpack_from('>%dH' % seg, self.data, rangeOff)
+        m = {}
+        for i in range(seg):
+            for c in range(starts[i], ends[i] + 1):
+                if c == 0xFFFF:
+                    continue
+                if ranges[i] == 0:
+                    g = (c + deltas[i]) & 0xFFFF
+                else:
+                    p = rangeOff + 2 * i + ranges[i] + 2 * (c - starts[i])
+                    g = struct.unpack_from('>H', self.data, p)[0]
+                    if g:
+                        g = (g + deltas[i]) & 0xFFFF
+                m[c] = g
+        return m
+
+    def advance(self, gid):
+        hmtx = self.tables['hmtx'][0]
+        i = min(gid, self.numHMetrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + 4 * i)[0]
+
+    def _glyphOffset(self, gid):
+        loca = self.tables['loca'][0]
+        if self.locFormat == 0:
+            a, b = struct.unpack_from('>HH', self.data, loca + 2 * gid)
+            a, b = 2 * a, 2 * b
+        else:
+            a, b = struct.unpack_from('>II', self.data, loca + 4 * gid)
+        return self.tables['glyf'][0] + a, b - a
+
+    def contours(self, gid):
+        """List of closed polylines in font units (quadratics flattened)."""
+        off, length = self._glyphOffset(gid)
+        if length == 0:
+            return []
+        nc = struct.unpack_from('>h', self.data, off)[0]
+        if nc < 0:
+            return self._composite(off + 10)
+
+        ends = struct.unpack_from('>%dH' % nc, self.data, off + 10)
+        p = off + 10 + 2 * nc
+        ilen = struct.unpack_from('>H', self.data, p)[0]
+        p += 2 + ilen
+        npts = ends[-1] + 1 if nc else 0
+
+        flags = []
+        while len(flags) < npts:
+            f = self.data[p]; p += 1
+            flags.append(f)
+            if f & 8:
+                r = self.data[p]; p += 1
+                flags.extend([f] * r)
+
+        def coords(short, same):
+            out, v = [], 0
+            nonlocal p
+            for f in flags:
+                if f & short:
+                    d = self.data[p]; p += 1
+                    v += d if f & same else -d
+                elif not f & same:
+                    v += struct.unpack_from('>h', self.data, p)[0]; p += 2
+                out.append(v)
+            return out
+
+        xs = coords(2, 16)
+        ys = coords(4, 32)
+
+        result, start = [], 0
+        for e in ends:
+            pts = [(xs[i], ys[i], flags[i] & 1) for i in range(start, e + 1)]
+            start = e + 1
+            result.append(flatten(pts))
+        return result
+
+    def _composite(self, p):
+        out = []
+        while True:
+            flags, gid = struct.unpack_from('>HH', self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from('>hh', self.data, p); p += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, p); p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from('>h', self.data, p)[0] / 16384.0; p += 2
+            elif flags & 0x40:
+                a, d = [v / 16384.0 for v in struct.unpack_from('>hh', self.data, p)]; p += 4
+            elif flags & 0x80:
+                a, b, c, d = [v / 16384.0 for v in struct.unpack_from('>hhhh', self.data, p)]; p += 8
+            for poly in self.contours(gid):
+                out.append([(a * x + c * y + dx, b * x + d * y + dy) for x, y in poly])
+            if not flags & 0x20:
+                return out
+
+
+def flatten(pts):
+    """TrueType on/off-curve points -> polyline."""
+    if not pts:
+        return []
+    # make sure we start on an on-curve point
+    if not pts[0][2]:
+        if pts[-1][2]:
+            pts = [pts[-1]] + pts[:-1]
+        else:
+            mid = ((pts[0][0] + pts[-1][0]) / 2.0, (pts[0][1] + pts[-1][1]) / 2.0, 1)
+            pts = [mid] + pts
+    out = [(pts[0][0], pts[0][1])]
+    n = len(pts)
+    i = 1
+    prev = pts[0]
+    while i <= n:
+        cur = pts[i % n]
+        if cur[2]:
+            out.append((cur[0], cur[1]))
+            prev = cur
+            i += 1
+            continue
+        nxt = pts[(i + 1) % n]
+        if nxt[2]:
+            end = nxt
+            i += 2
+        else:
+            end = ((cur[0] + nxt[0]) / 2.0, (cur[1] + nxt[1]) / 2.0, 1)
+            i += 1
+        for k in range(1, 9):
+            t = k / 8.0
+            x = (1 - t) ** 2 * prev[0] + 2 * (1 - t) * t * cur[0] + t * t * end[0]
+            y = (1 - t) ** 2 * prev[1] + 2 * (1 - t) * t * cur[1] + t * t * end[1]
+            out.append((x, y))
+        prev = end
+    return out
+
+
+def rasterise(tt, gid, px, cellW, cellH, baseline):
+    scale = px / float(tt.unitsPerEm) * SS
+    polys = [[(x * scale, (baseline * SS) - y * scale) for x, y in poly]
+             for poly in tt.contours(gid)]
+    W, H = cellW * SS, cellH * SS
+    cover = [[0] * cellW for _ in range(cellH)]
+    for sy in range(H):
+        yc = sy + 0.5
+        xings = []
+        for poly in polys:
+            for j in range(len(poly)):
+                x0, y0 = poly[j]
+                x1, y1 = poly[(j + 1) % len(poly)]
+                if (y0 <= yc) != (y1 <= yc):
+                    x = x0 + (yc - y0) * (x1 - x0) / (y1 - y0)
+                    xings.append((x, 1 if y1 > y0 else -1))
+        xings.sort()
+        wind = 0
+        for k in range(len(xings) - 1):
+            wind += xings[k][1]
+            if wind == 0:
+                continue
+            a = max(0, int(xings[k][0] + 0.5))
+            b = min(W, int(xings[k + 1][0] + 0.5))
+            for sx in range(a, b):
+                cover[sy // SS][sx // SS] += 1
+    half = SS * SS // 2
+    return [[1 if c >= half else 0 for c in row] for row in cover]
+
+
+def encode(bitmap):
+    flat = [p for row in bitmap for p in row]
+    runs, i = [], 0
+    while i < len(flat):
+        c = flat[i]
+        n = 1
+        while i + n < len(flat) and flat[i + n] == c and n < 128:
+            n += 1
+        runs.append((0x80 if c else 0) | (n - 1))
+        i += n
+    return runs
+
+
+def main():
+    if len(sys.argv) < 4:
+        sys.exit(__doc__ if __doc__ else 'usage: fontconv.py font.ttf size name [out.cpp]')
+    path, px, name = sys.argv[1], int(sys.argv[2]), sys.argv[3]
+    out = sys.argv[4] if len(sys.argv) > 4 else name[0].upper() + name[1:] + '.cpp'
+
+    tt = TrueType(path)
+    k = px / float(tt.unitsPerEm)
+    baseline = int(round(tt.ascent * k))
+    height = baseline + int(round(-tt.descent * k))
+
+    glyphs, runs = [], []
+    for cp in CHARSET:
+        gid = tt.cmap.get(cp)
+        if gid is None:
+            print('warning: U+%04X not in font, skipped' % cp, file=sys.stderr)
+            continue
+        adv = max(1, int(round(tt.advance(gid) * k)))
+        bm = rasterise(tt, gid, px, adv, height, baseline)
+        glyphs.append((cp, len(runs), adv))
+        runs.extend(encode(bm))
+        if '--preview' in sys.argv:
+            print('U+%04X' % cp)
+            for row in bm:
+                print(''.join('#' if p else '.' for p in row))
+
+    with open(out, 'w', newline='\r\n') as f:
+        f.write('// %s - generated by tools/fontconv.py, do not edit\n' % out.split('/')[-1])
+        f.write('// source: %s @ %d px, %d glyphs, %d run bytes\n\n'
+                % (path.split('/')[-1], px, len(glyphs), len(runs)))
+        f.write('#include "RleFont.h"\n\n')
+        f.write('static const uint8_t %sRuns[] PROGMEM = {\n' % name)
+        for i in range(0, len(runs), 16):
+            f.write('    ' + ', '.join('0x%02X' % r for r in runs[i:i + 16]) + ',\n')
+        f.write('};\n\n')
+        f.write('static const RleGlyph %sGlyphs[] PROGMEM = {\n' % name)
+        for cp, off, adv in glyphs:
+            f.write('    { 0x%04X, %5d, %2d },\n' % (cp, off, adv))
+        f.write('};\n\n')
+        f.write('const RleFont %s = {\n' % name)
+        f.write('    %sRuns, %sGlyphs, %d, %d, %d\n' % (name, name, len(glyphs), height, baseline))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    main()